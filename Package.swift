@@ -36,7 +36,10 @@ let package = Package(
             path: "Sources/ZyraFormSupabase"),
         .testTarget(
             name: "ZyraFormTests",
-            dependencies: ["ZyraForm"],
+            dependencies: [
+                "ZyraForm",
+                .product(name: "PowerSync", package: "powersync-swift")
+            ],
             path: "Tests/ZyraFormTests")
     ]
 )
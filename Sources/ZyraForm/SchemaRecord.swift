@@ -16,27 +16,43 @@ public struct SchemaRecord: Identifiable {
     /// The schema this record conforms to
     public let schema: ZyraTable
     
-    /// The underlying data dictionary
-    private let data: [String: Any]
+    /// The underlying values, stored compactly by column ordinal
+    public let row: ZyraRow
+    
+    /// Columns that were loaded or set, so a null in one of them is a value rather than a gap
+    public let presentColumns: Set<String>
     
     /// Initialize with schema and data
     public init(schema: ZyraTable, data: [String: Any]) {
         self.schema = schema
-        self.data = data
+        self.row = ZyraRow(layout: schema.rowLayout, dictionary: data)
+        self.presentColumns = Set(data.keys)
+    }
+    
+    /// Initialize with schema and a decoded row (no dictionary in between)
+    /// Every column of the row's layout counts as loaded
+    public init(schema: ZyraTable, row: ZyraRow) {
+        self.init(schema: schema, row: row, presentColumns: Set(row.layout.names))
+    }
+    
+    private init(schema: ZyraTable, row: ZyraRow, presentColumns: Set<String>) {
+        self.schema = schema
+        self.row = row
+        self.presentColumns = presentColumns
     }
     
     /// Get the ID (required by Identifiable)
     public var id: String {
-        return data[schema.primaryKey] as? String ?? UUID().uuidString
+        return row[schema.primaryKey] as? String ?? UUID().uuidString
     }
     
     /// Get a value for a field with type conversion
     public func get<T>(_ field: String, as type: T.Type) -> T? {
-        guard let column = schema.columns.first(where: { $0.name == field }) else {
+        guard let column = schema.column(named: field) else {
             return nil
         }
         
-        let value = data[field]
+        let value = row[field]
         
         // Handle nil
         guard let value = value else {
@@ -71,7 +87,7 @@ public struct SchemaRecord: Identifiable {
             if let dateValue = value as? Date {
                 return dateValue as? T
             } else if let strValue = value as? String {
-                return ISO8601DateFormatter().date(from: strValue) as? T
+                return ZyraTimestamp.date(from: strValue) as? T
             }
             return nil
         } else if T.self == String.self {
@@ -91,18 +107,18 @@ public struct SchemaRecord: Identifiable {
     
     /// Set a value (creates a new record)
     public func setting(_ field: String, to value: Any) -> SchemaRecord {
-        var newData = data
-        newData[field] = value
-        return SchemaRecord(schema: schema, data: newData)
+        var newRow = row
+        newRow.set(field, to: value)
+        return SchemaRecord(schema: schema, row: newRow, presentColumns: presentColumns.union([field]))
     }
     
     /// Set multiple values at once (creates a new record)
     public func setting(_ values: [String: Any]) -> SchemaRecord {
-        var newData = data
+        var newRow = row
         for (key, value) in values {
-            newData[key] = value
+            newRow.set(key, to: value)
         }
-        return SchemaRecord(schema: schema, data: newData)
+        return SchemaRecord(schema: schema, row: newRow, presentColumns: presentColumns.union(values.keys))
     }
     
     /// Convenience: Create record from dictionary
@@ -111,8 +127,9 @@ public struct SchemaRecord: Identifiable {
     }
     
     /// Convert to dictionary for database operations
+    /// Null columns are NSNull when they were loaded or set (so an update clears them) and left out otherwise
     public func toDictionary(excluding columns: [String] = []) -> [String: Any] {
-        var result = data
+        var result = row.dictionary.filter { !($0.value is NSNull) || presentColumns.contains($0.key) }
         
         // Convert types based on schema
         for column in schema.columns {
@@ -125,7 +142,7 @@ public struct SchemaRecord: Identifiable {
                 }
             case .date:
                 if let dateValue = value as? Date {
-                    result[column.name] = ISO8601DateFormatter().string(from: dateValue)
+                    result[column.name] = ZyraTimestamp.string(from: dateValue)
                 }
             default:
                 break
@@ -142,7 +159,20 @@ public struct SchemaRecord: Identifiable {
     
     /// Subscript access for convenience
     public subscript(field: String) -> Any? {
-        return data[field]
+        return row[field]
+    }
+    
+    /// This record with the columns of `other` filled in (e.g. detail columns loaded on demand)
+    /// Columns of `other` win; the result uses the schema's full column layout
+    public func merging(_ other: ZyraRow) -> SchemaRecord {
+        var merged = ZyraRow(layout: schema.rowLayout)
+        for source in [row, other] {
+            for (name, value) in zip(source.layout.names, source.values) {
+                guard let ordinal = schema.ordinal(of: name) else { continue }
+                merged.set(ordinal, to: value)
+            }
+        }
+        return SchemaRecord(schema: schema, row: merged, presentColumns: presentColumns.union(other.layout.names))
     }
 }
 
@@ -194,6 +224,12 @@ public class SchemaBasedSync: ObservableObject {
     
     @Published public var records: [SchemaRecord] = []
     
+    /// Loads the columns outside `schema.listProjection` on demand
+    private lazy var detailLoader = ZyraDetailLoader(service: service, table: schema, fields: schema.detailFields)
+    
+    /// Records by primary key, reused across emissions for rows that did not change
+    private var recordsById: [String: SchemaRecord] = [:]
+    
     public init(
         schema: ZyraTable,
         userId: String,
@@ -206,8 +242,10 @@ public class SchemaBasedSync: ObservableObject {
             tableName: schema.name,
             userId: userId,
             database: database,
-            encryptionManager: encryptionManager
+            encryptionManager: encryptionManager,
+            primaryKey: schema.primaryKey
         )
+        service.columnOrder = ZyraColumnOrder(schema.fieldConfig.allFields)
         
         // Set up real-time watching if enabled
         if watchForUpdates {
@@ -250,19 +288,71 @@ public class SchemaBasedSync: ObservableObject {
     
     /// Set up real-time watch for PowerSync updates
     private func setupWatch() {
+        let changes = service.changeStream()
         watchTask = Task { [weak self] in
-            guard let self = self else { return }
+            // Apply each keyed change set; only inserted/updated rows become new SchemaRecords
+            for await changeSet in changes {
+                guard let self = self else { return }
+                self.syncRecords(changedIds: changeSet.isReset ? nil : changeSet.changedIds)
+            }
+        }
+    }
+    
+    /// Seconds from starting the current watch to its first published snapshot
+    public var timeToFirstRow: TimeInterval? {
+        return service.timeToFirstRow
+    }
+    
+    /// Watch snapshots dropped because a newer one arrived while the previous was still being processed
+    public var droppedEmissions: Int {
+        return service.droppedEmissions
+    }
+    
+    /// Coalesce `updateRecord` calls per record; `records` show pending values (see `ZyraSync.writeBehind`)
+    public var writeBehind: ZyraWriteBehind? {
+        get { service.writeBehind }
+        set { service.writeBehind = newValue }
+    }
+    
+    /// Write every pending write-behind update now
+    public func flushPendingWrites() async throws {
+        try await service.flushPendingWrites()
+    }
+    
+    /// Stream of keyed change sets for subscribers that want deltas rather than `records`
+    public func changeStream() -> AsyncStream<ZyraChangeSet> {
+        return service.changeStream()
+    }
+    
+    /// Rebuild `records` from the service rows, reusing existing SchemaRecords for unchanged rows
+    /// - Parameter changedIds: IDs known to have changed; nil compares row values instead
+    private func syncRecords(changedIds: Set<String>?) {
+        let rows = service.rows
+        var byId = [String: SchemaRecord](minimumCapacity: rows.count)
+        
+        records = rows.map { row in
+            guard let id = row.string(schema.primaryKey) else {
+                return SchemaRecord(schema: schema, row: row)
+            }
             
-            // Watch the service's records for changes
-            for await _ in self.service.$records.values {
-                // Convert dictionaries to SchemaRecords whenever records update
-                await MainActor.run {
-                    self.records = self.service.records.map { record in
-                        self.schema.createRecord(from: record)
-                    }
-                }
+            let record: SchemaRecord
+            if let existing = recordsById[id], isUnchanged(existing, row, changedIds: changedIds) {
+                record = existing
+            } else {
+                record = SchemaRecord(schema: schema, row: row)
             }
+            byId[id] = record
+            return record
+        }
+        recordsById = byId
+    }
+    
+    private func isUnchanged(_ existing: SchemaRecord, _ row: ZyraRow, changedIds: Set<String>?) -> Bool {
+        if let changedIds = changedIds, let id = row.string(schema.primaryKey) {
+            return !changedIds.contains(id)
         }
+        // `updated_at` alone misses edits within the same second and writes without autoTimestamp
+        return existing.row == row
     }
     
     /// Load records as SchemaRecords
@@ -275,19 +365,22 @@ public class SchemaBasedSync: ObservableObject {
     /// - Custom SQL: Use `loadRecordsWithRawSQL(sql:parameters:)` for complex queries
     ///
     /// - Parameters:
-    ///   - fields: Array of field names to retrieve (nil = all fields)
+    ///   - fields: Array of field names to retrieve (nil = the schema's `listProjection`, which is every field
+    ///     unless the schema declares `listFields`; load the rest with `detailed(_:)`)
     ///   - whereClause: SQL WHERE clause without "WHERE" keyword (e.g., "user_id = ? AND is_completed = ?")
     ///   - parameters: Parameters for the WHERE clause (use ? placeholders)
     ///   - orderBy: Optional ORDER BY clause (e.g., "created_at DESC")
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
     public func loadRecords(
         fields: [String]? = nil,
         whereClause: String? = nil,
         parameters: [Any] = [],
-        orderBy: String? = nil
+        orderBy: String? = nil,
+        timeout: TimeInterval? = nil
     ) async throws {
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         
-        let fieldsToLoad = fields ?? config.allFields
+        let fieldsToLoad = fields ?? schema.listProjection
         let orderByClause = orderBy ?? config.defaultOrderBy
         
         try await service.loadRecords(
@@ -297,14 +390,26 @@ public class SchemaBasedSync: ObservableObject {
             orderBy: orderByClause,
             encryptedFields: config.encryptedFields,
             integerFields: config.integerFields,
-            booleanFields: config.booleanFields
+            booleanFields: config.booleanFields,
+            timeout: timeout
         )
         
-        // Convert dictionaries to SchemaRecords
+        // Convert rows to SchemaRecords
         // Note: If watch is active, this will also update automatically
-        records = service.records.map { record in
-            schema.createRecord(from: record)
-        }
+        syncRecords(changedIds: nil)
+    }
+    
+    /// Load records with a typed query built from this schema
+    /// A query without `select` loads the schema's `listProjection`
+    /// - Parameters:
+    ///   - query: Query, e.g. `schema.query().where("is_completed", equals: false)`
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func loadRecords(query: ZyraQuery, timeout: TimeInterval? = nil) async throws {
+        try await service.loadRecords(query: listed(query), timeout: timeout)
+        
+        // Convert rows to SchemaRecords
+        syncRecords(changedIds: nil)
     }
     
     /// Load records using a raw SQL query for advanced filtering
@@ -334,11 +439,13 @@ public class SchemaBasedSync: ObservableObject {
     /// - Parameters:
     ///   - sql: Complete SQL SELECT query (must include SELECT, FROM, and optionally WHERE, ORDER BY, LIMIT, etc.)
     ///   - parameters: Parameters for the SQL query (use ? placeholders)
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
     public func loadRecordsWithRawSQL(
         sql: String,
-        parameters: [Any] = []
+        parameters: [Any] = [],
+        timeout: TimeInterval? = nil
     ) async throws {
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         
         // Extract field names from SQL for proper mapping
         // Try to detect fields from SELECT clause, fallback to all fields
@@ -369,13 +476,12 @@ public class SchemaBasedSync: ObservableObject {
             fieldsToRead: fieldsToRead,
             encryptedFields: config.encryptedFields,
             integerFields: config.integerFields,
-            booleanFields: config.booleanFields
+            booleanFields: config.booleanFields,
+            timeout: timeout
         )
         
-        // Convert dictionaries to SchemaRecords
-        records = service.records.map { record in
-            schema.createRecord(from: record)
-        }
+        // Convert rows to SchemaRecords
+        syncRecords(changedIds: nil)
     }
     
     /// Create a record
@@ -384,17 +490,17 @@ public class SchemaBasedSync: ObservableObject {
         autoGenerateId: Bool = true,
         autoTimestamp: Bool = true
     ) async throws -> String {
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         
         var dict = record.toDictionary()
         
         // Ensure id, created_at, and updated_at are present if auto-generation is enabled
         if autoGenerateId && dict["id"] == nil {
-            dict["id"] = UUID().uuidString
+            dict["id"] = ZyraSync.canonicalId(UUID().uuidString)
         }
         
         if autoTimestamp {
-            let now = ISO8601DateFormatter().string(from: Date())
+            let now = ZyraTimestamp.now()
             if dict["created_at"] == nil {
                 dict["created_at"] = now
             }
@@ -406,6 +512,50 @@ public class SchemaBasedSync: ObservableObject {
         return try await service.createRecord(
             fields: dict,
             encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoGenerateId: autoGenerateId,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Create a record, or update the record with its id when one exists (see `ZyraSync.upsertRecords`)
+    /// - Returns: The record's id
+    public func upsertRecord(
+        _ record: SchemaRecord,
+        autoTimestamp: Bool = true
+    ) async throws -> String {
+        return try await upsertRecords([record], autoTimestamp: autoTimestamp)[0]
+    }
+    
+    /// Create or update several records by id in one write transaction (see `ZyraSync.upsertRecords`)
+    /// - Returns: Ids of the records, in input order
+    public func upsertRecords(
+        _ records: [SchemaRecord],
+        autoTimestamp: Bool = true
+    ) async throws -> [String] {
+        let config = schema.fieldConfig
+        
+        return try await service.upsertRecords(
+            records: records.map { $0.toDictionary() },
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Create several records in one write transaction (see `ZyraSync.createRecords`)
+    /// - Returns: Ids of the created records, in input order
+    public func createRecords(
+        _ records: [SchemaRecord],
+        autoGenerateId: Bool = true,
+        autoTimestamp: Bool = true
+    ) async throws -> [String] {
+        let config = schema.fieldConfig
+        
+        return try await service.createRecords(
+            records: records.map { $0.toDictionary() },
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
             autoGenerateId: autoGenerateId,
             autoTimestamp: autoTimestamp
         )
@@ -416,7 +566,7 @@ public class SchemaBasedSync: ObservableObject {
         _ record: SchemaRecord,
         autoTimestamp: Bool = true
     ) async throws {
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         
         var dict = record.toDictionary(excluding: ["id", "created_at"])
         
@@ -424,6 +574,42 @@ public class SchemaBasedSync: ObservableObject {
             id: record.id,
             fields: dict,
             encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Update several records in one write transaction (see `ZyraSync.updateRecords(_:encryptedFields:blindIndexedFields:autoTimestamp:)`)
+    public func updateRecords(
+        _ records: [SchemaRecord],
+        autoTimestamp: Bool = true
+    ) async throws {
+        let config = schema.fieldConfig
+        
+        try await service.updateRecords(
+            records.map { (id: $0.id, fields: $0.toDictionary(excluding: ["id", "created_at"])) },
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Set the same fields on every record matching a query's filters, with one UPDATE statement
+    /// - Parameters:
+    ///   - query: Filters, e.g. `schema.query().where("project_id", equals: projectId)`
+    ///   - fields: Columns to set and their new values
+    public func updateRecords(
+        matching query: ZyraQuery,
+        set fields: [String: Any],
+        autoTimestamp: Bool = true
+    ) async throws {
+        let config = schema.fieldConfig
+        
+        try await service.updateRecords(
+            matching: query,
+            set: fields,
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
             autoTimestamp: autoTimestamp
         )
     }
@@ -435,16 +621,18 @@ public class SchemaBasedSync: ObservableObject {
     
     // MARK: - Convenience Query Methods
     
+    // These are single reads: they return the matching rows directly
+    // and leave the watch and `records` untouched
+    
     /// Get all records (no filtering)
     /// - Returns: Array of all SchemaRecords
     ///
     /// **To filter by user, use:**
     /// ```swift
-    /// try await service.loadRecords(whereClause: "user_id = ?", parameters: [userId])
+    /// try await service.getAll(where: "user_id = ?", parameters: [userId])
     /// ```
     public func getAll() async throws -> [SchemaRecord] {
-        try await loadRecords()
-        return records
+        return try await fetch()
     }
     
     /// Get all records matching a WHERE clause
@@ -459,19 +647,135 @@ public class SchemaBasedSync: ObservableObject {
     /// - Filter by multiple conditions: `getAll(where: "user_id = ? AND is_completed = ?", parameters: [userId, "false"])`
     /// - Filter with LIKE: `getAll(where: "title LIKE ?", parameters: ["%important%"])`
     public func getAll(where whereClause: String, parameters: [Any] = [], orderBy: String? = nil) async throws -> [SchemaRecord] {
-        try await loadRecords(whereClause: whereClause, parameters: parameters, orderBy: orderBy)
-        return records
+        return try await fetch(whereClause: whereClause, parameters: parameters, orderBy: orderBy)
+    }
+    
+    /// Keyset-paged, windowed watch over this schema's table (see `ZyraSync.pager(query:pageSize:)`)
+    /// Read pages as SchemaRecords through `pager.schemaRecords`
+    /// - Parameters:
+    ///   - query: Filters and ordering (nil = every row, ordered by `defaultOrderBy`); without `select`
+    ///     pages load the schema's `listProjection`
+    ///   - pageSize: Rows per page
+    public func pager(query: ZyraQuery? = nil, pageSize: Int = 50) -> ZyraPager {
+        return service.pager(query: listed(query ?? schema.query()), pageSize: pageSize)
+    }
+    
+    /// `query` restricted to the list projection when it selects every column
+    private func listed(_ query: ZyraQuery) -> ZyraQuery {
+        guard query.projection == nil, !schema.detailFields.isEmpty else { return query }
+        return query.select(schema.listProjection)
+    }
+    
+    // MARK: - Detail Columns
+    
+    /// The record with every column, loading the columns outside `schema.listProjection` on first access
+    /// Records requested together share one query; loaded columns are memoized until the record's `updated_at` changes
+    /// - Returns: The complete record (`record` itself when nothing is left to load or the row no longer exists)
+    public func detailed(_ record: SchemaRecord) async throws -> SchemaRecord {
+        guard needsDetails(record), let id = record.row.string(schema.primaryKey) else { return record }
+        
+        guard let detail = try await detailLoader.row(id: id, version: record.row.string("updated_at")) else {
+            return record
+        }
+        return record.merging(detail)
+    }
+    
+    /// Complete records for several list records, loaded in one batched read (see `detailed(_:)`)
+    public func detailed(_ records: [SchemaRecord]) async throws -> [SchemaRecord] {
+        var versions: [String: String] = [:]
+        let ids = records.filter { needsDetails($0) }.compactMap { record -> String? in
+            guard let id = record.row.string(schema.primaryKey) else { return nil }
+            versions[id] = record.row.string("updated_at")
+            return id
+        }
+        guard !ids.isEmpty else { return records }
+        
+        let details = try await detailLoader.rows(ids: ids, versions: versions)
+        return records.map { record in
+            guard let id = record.row.string(schema.primaryKey), let detail = details[id] else { return record }
+            return record.merging(detail)
+        }
+    }
+    
+    /// Value of `field`, loading the record's detail columns first when the field is not listed
+    public func value(_ field: String, of record: SchemaRecord) async throws -> Any? {
+        guard !schema.isListed(field) else { return record[field] }
+        return try await detailed(record)[field]
+    }
+    
+    /// Whether the record was read without some of the schema's detail columns
+    private func needsDetails(_ record: SchemaRecord) -> Bool {
+        guard !schema.detailFields.isEmpty else { return false }
+        let layout = record.row.layout
+        return schema.detailFields.contains { layout.ordinal(of: $0) == nil }
+    }
+    
+    // MARK: - Search
+    
+    /// Ranked full-text search over the schema's `searchable()` columns
+    /// Runs against the local FTS5 index (see `ZyraSchema.installSearchIndexes(on:)`), so each keystroke
+    /// is an index lookup rather than a `LIKE` scan; matches are joined back to their rows
+    ///
+    /// **Example Usage:**
+    /// ```swift
+    /// let results = try await sync.search("quarterly rep", in: sync.schema.query().where("user_id", equals: userId))
+    /// ```
+    ///
+    /// - Parameters:
+    ///   - text: Words to find; each matches as a prefix, in any searchable column
+    ///   - query: Optional filters on the matches (nil = all rows); without `select` the `listProjection` is read
+    ///   - limit: Maximum number of records
+    /// - Returns: Matching records, best match first
+    public func search(_ text: String, in query: ZyraQuery? = nil, limit: Int = 50) async throws -> [SchemaRecord] {
+        let rows = try await service.searchRows(text, query: listed(query ?? schema.query()), limit: limit)
+        return rows.map { record(for: $0) }
+    }
+    
+    // MARK: - Aggregates
+    
+    /// Run an aggregate over this schema's table in SQLite (see `ZyraAggregateQuery`)
+    ///
+    /// **Example Usage:**
+    /// ```swift
+    /// let totals = try await sync.aggregate(
+    ///     sync.schema.query().aggregate(.count(), .sum("estimate"), groupBy: ["status"])
+    /// )
+    /// ```
+    public func aggregate(_ query: ZyraAggregateQuery) async throws -> [ZyraRow] {
+        return try await service.aggregate(query)
+    }
+    
+    /// Number of rows matching a query's filters (nil = every row), counted in SQLite
+    public func count(_ query: ZyraQuery? = nil) async throws -> Int {
+        return try await service.count(query ?? schema.query())
+    }
+    
+    /// Live aggregate over this schema's table (see `ZyraSync.watchAggregate(_:)`)
+    public func watchAggregate(_ query: ZyraAggregateQuery) throws -> AsyncThrowingStream<[ZyraRow], Error> {
+        return try service.watchAggregate(query)
+    }
+    
+    /// Live count of rows matching a query's filters (nil = every row), for badges and dashboard counters
+    public func watchCount(_ query: ZyraQuery? = nil) throws -> AsyncThrowingMapSequence<AsyncThrowingStream<[ZyraRow], Error>, Int> {
+        return try service.watchCount(query ?? schema.query())
+    }
+    
+    /// Get all records matching a typed query
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func getAll(query: ZyraQuery) async throws -> [SchemaRecord] {
+        return try await service.fetchRows(query: query).map { record(for: $0) }
     }
     
     /// Get one record by ID
     /// - Parameter id: Record ID
     /// - Returns: SchemaRecord if found, nil otherwise
     public func getOne(id: String) async throws -> SchemaRecord? {
-        try await loadRecords(
-            whereClause: "\(schema.primaryKey) = ?",
-            parameters: [id]
-        )
-        return records.first
+        let ids = ZyraSync.storedIds(id)
+        return try await fetch(
+            whereClause: "\"\(schema.primaryKey)\" IN (\(ZyraSync.placeholders(ids.count)))",
+            parameters: ids,
+            limit: 1
+        ).first
     }
     
     /// Get first record matching a WHERE clause
@@ -481,9 +785,41 @@ public class SchemaBasedSync: ObservableObject {
     ///   - orderBy: Optional ORDER BY clause, e.g., "created_at DESC"
     /// - Returns: First matching SchemaRecord, or nil if none found
     public func getFirst(where whereClause: String, parameters: [Any] = [], orderBy: String? = nil) async throws -> SchemaRecord? {
-        let orderByClause = orderBy ?? schema.defaultOrderBy
-        try await loadRecords(whereClause: whereClause, parameters: parameters, orderBy: orderByClause)
-        return records.first
+        return try await fetch(whereClause: whereClause, parameters: parameters, orderBy: orderBy, limit: 1).first
+    }
+    
+    /// Single read of SchemaRecords matching a WHERE clause
+    private func fetch(
+        whereClause: String? = nil,
+        parameters: [Any] = [],
+        orderBy: String? = nil,
+        limit: Int? = nil
+    ) async throws -> [SchemaRecord] {
+        let config = schema.fieldConfig
+        
+        let rows = try await service.fetchRows(
+            fields: config.allFields,
+            whereClause: whereClause,
+            parameters: parameters,
+            orderBy: orderBy ?? config.defaultOrderBy,
+            limit: limit,
+            encryptedFields: config.encryptedFields,
+            integerFields: config.integerFields,
+            booleanFields: config.booleanFields
+        )
+        return rows.map { record(for: $0) }
+    }
+    
+    /// SchemaRecord for a fetched row, reusing the watched record when the row is unchanged
+    /// and the watch read the same columns (a list projection does not satisfy a full read)
+    private func record(for row: ZyraRow) -> SchemaRecord {
+        if let id = row.string(schema.primaryKey),
+           let existing = recordsById[id],
+           existing.row.layout.names == row.layout.names,
+           isUnchanged(existing, row, changedIds: nil) {
+            return existing
+        }
+        return SchemaRecord(schema: schema, row: row)
     }
 }
 
@@ -10,17 +10,42 @@ import CryptoKit
 import Security
 
 /// Secure encryption manager with per-user key derivation
-public final class SecureEncryptionManager {
+/// Thread-safe: keys are cached behind a lock so rows can be decrypted from several tasks at once
+public final class SecureEncryptionManager: @unchecked Sendable {
     public static let shared = SecureEncryptionManager()
     
     private init() {}
     
+    // MARK: - Key Cache
+    
+    /// Master key and derived user keys, so decrypting a row does not hit the Keychain or re-run HKDF
+    private let keyLock = NSLock()
+    private var cachedMasterKey: SymmetricKey?
+    private var cachedUserKeys: [String: SymmetricKey] = [:]
+    private var cachedBlindIndexKeys: [String: SymmetricKey] = [:]
+    
+    /// Forget cached keys; called whenever the Keychain entry changes
+    private func clearKeyCache() {
+        keyLock.lock()
+        cachedMasterKey = nil
+        cachedUserKeys.removeAll()
+        cachedBlindIndexKeys.removeAll()
+        keyLock.unlock()
+    }
+    
     // MARK: - Master Key Management
     
     /// Get or create master encryption key from Keychain
     private func getMasterKey() throws -> SymmetricKey {
-        let keyData = try getMasterKeyFromKeychain()
-        return SymmetricKey(data: keyData)
+        keyLock.lock()
+        defer { keyLock.unlock() }
+        
+        if let masterKey = cachedMasterKey {
+            return masterKey
+        }
+        let masterKey = SymmetricKey(data: try getMasterKeyFromKeychain())
+        cachedMasterKey = masterKey
+        return masterKey
     }
     
     /// Get master key from Keychain or create new one
@@ -69,6 +94,14 @@ public final class SecureEncryptionManager {
     
     /// Derive a user-specific encryption key using HKDF
     private func deriveUserKey(userId: String) throws -> SymmetricKey {
+        keyLock.lock()
+        let cachedUserKey = cachedUserKeys[userId]
+        keyLock.unlock()
+        
+        if let userKey = cachedUserKey {
+            return userKey
+        }
+        
         let masterKey = try getMasterKey()
         let masterKeyData = masterKey.withUnsafeBytes { Data($0) }
         
@@ -83,7 +116,13 @@ public final class SecureEncryptionManager {
             keyLength: 32 // 256 bits for AES-256
         )
         
-        return SymmetricKey(data: derivedKeyData)
+        let userKey = SymmetricKey(data: derivedKeyData)
+        
+        keyLock.lock()
+        cachedUserKeys[userId] = userKey
+        keyLock.unlock()
+        
+        return userKey
     }
     
     // MARK: - Encryption/Decryption
@@ -148,7 +187,7 @@ public final class SecureEncryptionManager {
         }
         
         // Check if the text appears to be encrypted (base64 and longer than original)
-        if encryptedText.count > 20 && encryptedText.range(of: "^[A-Za-z0-9+/]*={0,2}$", options: .regularExpression) != nil {
+        if looksEncrypted(encryptedText) {
             do {
                 return try decryptShared(encryptedText)
             } catch {
@@ -212,7 +251,7 @@ public final class SecureEncryptionManager {
         }
         
         // Check if the text appears to be encrypted (base64 and longer than original)
-        if encryptedText.count > 20 && encryptedText.range(of: "^[A-Za-z0-9+/]*={0,2}$", options: .regularExpression) != nil {
+        if looksEncrypted(encryptedText) {
             do {
                 // Try new per-user decryption first
                 return try decrypt(encryptedText, for: userId)
@@ -225,6 +264,78 @@ public final class SecureEncryptionManager {
         }
     }
     
+    // MARK: - Blind Index
+    
+    /// Deterministic lookup token for an encrypted column's plaintext (see `ColumnBuilder.blindIndexed()`)
+    /// HMAC-SHA256 under a key derived from the user key and the field name, so tokens of different
+    /// fields or users never match. The plaintext is trimmed, NFC-normalized and lowercased first,
+    /// making lookups insensitive to case and Unicode composition. Computed even when encryption is
+    /// disabled, so tokens stay valid if it is turned on later
+    public func blindIndex(_ plaintext: String, field: String, for userId: String) throws -> String {
+        let normalized = plaintext
+            .trimmingCharacters(in: .whitespacesAndNewlines)
+            .precomposedStringWithCanonicalMapping
+            .lowercased()
+        let mac = HMAC<SHA256>.authenticationCode(
+            for: Data(normalized.utf8),
+            using: try blindIndexKey(field: field, userId: userId)
+        )
+        return Data(mac).base64EncodedString()
+    }
+    
+    private func blindIndexKey(field: String, userId: String) throws -> SymmetricKey {
+        let cacheKey = "\(userId)\u{0}\(field)"
+        keyLock.lock()
+        let cachedKey = cachedBlindIndexKeys[cacheKey]
+        keyLock.unlock()
+        
+        if let key = cachedKey {
+            return key
+        }
+        
+        let key = HKDF<SHA256>.deriveKey(
+            inputKeyMaterial: try deriveUserKey(userId: userId),
+            info: Data("blind-index:\(field)".utf8),
+            outputByteCount: 32
+        )
+        
+        keyLock.lock()
+        cachedBlindIndexKeys[cacheKey] = key
+        keyLock.unlock()
+        
+        return key
+    }
+    
+    /// Check if the text appears to be encrypted: longer than 20 characters and base64 (`^[A-Za-z0-9+/]*={0,2}$`)
+    /// Scans the UTF-8 bytes directly instead of compiling a regular expression for every value
+    private func looksEncrypted(_ text: String) -> Bool {
+        let bytes = text.utf8
+        guard bytes.count > 20 else { return false }
+        
+        var padding = 0
+        for byte in bytes {
+            if byte == UInt8(ascii: "=") {
+                padding += 1
+                if padding > 2 { return false }
+                continue
+            }
+            // No data characters may follow padding
+            guard padding == 0 else { return false }
+            
+            switch byte {
+            case UInt8(ascii: "A")...UInt8(ascii: "Z"),
+                 UInt8(ascii: "a")...UInt8(ascii: "z"),
+                 UInt8(ascii: "0")...UInt8(ascii: "9"),
+                 UInt8(ascii: "+"),
+                 UInt8(ascii: "/"):
+                continue
+            default:
+                return false
+            }
+        }
+        return true
+    }
+    
     /// Check if encryption is enabled in user settings
     public var isEncryptionEnabled: Bool {
         // Check if the key exists in UserDefaults
@@ -279,6 +390,11 @@ public final class SecureEncryptionManager {
         ]
         
         let status = SecItemAdd(addQuery as CFDictionary, nil)
+        
+        // Cached keys and plaintexts came from the old key
+        clearKeyCache()
+        ZyraDecryptCache.invalidateAll()
+        
         if status != errSecSuccess {
             throw SecureEncryptionError.keyStorageFailed
         }
@@ -292,6 +408,11 @@ public final class SecureEncryptionManager {
         ]
         
         let status = SecItemDelete(deleteQuery as CFDictionary)
+        
+        // Cached keys and plaintexts must not outlive the Keychain entry
+        clearKeyCache()
+        ZyraDecryptCache.invalidateAll()
+        
         if status != errSecSuccess && status != errSecItemNotFound {
             throw SecureEncryptionError.keyRetrievalFailed
         }
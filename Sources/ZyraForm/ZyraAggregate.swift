@@ -0,0 +1,211 @@
+//
+//  ZyraAggregate.swift
+//  ZyraForm
+//
+//  COUNT/SUM/MIN/MAX/AVG with GROUP BY, computed by SQLite
+//
+
+import Foundation
+import PowerSync
+
+// MARK: - Aggregate
+
+/// One aggregate column of a `ZyraAggregateQuery`
+public struct ZyraAggregate: Hashable {
+    public enum Function: String, Hashable {
+        case count = "COUNT"
+        case sum = "SUM"
+        case min = "MIN"
+        case max = "MAX"
+        case average = "AVG"
+    }
+
+    public let function: Function
+    /// Aggregated column (nil = `COUNT(*)`)
+    public let column: String?
+    /// Name of the result column
+    public let alias: String
+
+    /// Number of rows
+    public static func count(as alias: String = "count") -> ZyraAggregate {
+        return ZyraAggregate(function: .count, column: nil, alias: alias)
+    }
+
+    /// Number of rows where `column` is not NULL (allowed on encrypted columns)
+    public static func count(_ column: String, as alias: String? = nil) -> ZyraAggregate {
+        return ZyraAggregate(function: .count, column: column, alias: alias ?? "count_\(column)")
+    }
+
+    /// Sum of `column` (NULL when no row matches)
+    public static func sum(_ column: String, as alias: String? = nil) -> ZyraAggregate {
+        return ZyraAggregate(function: .sum, column: column, alias: alias ?? "sum_\(column)")
+    }
+
+    /// Smallest value of `column`
+    public static func min(_ column: String, as alias: String? = nil) -> ZyraAggregate {
+        return ZyraAggregate(function: .min, column: column, alias: alias ?? "min_\(column)")
+    }
+
+    /// Largest value of `column`
+    public static func max(_ column: String, as alias: String? = nil) -> ZyraAggregate {
+        return ZyraAggregate(function: .max, column: column, alias: alias ?? "max_\(column)")
+    }
+
+    /// Mean of `column`
+    public static func average(_ column: String, as alias: String? = nil) -> ZyraAggregate {
+        return ZyraAggregate(function: .average, column: column, alias: alias ?? "avg_\(column)")
+    }
+}
+
+// MARK: - Aggregate Query
+
+/// Aggregates over the rows matching a `ZyraQuery`'s filters, one result row per group
+/// The query's ordering, limit, offset and projection do not apply; groups are ordered by the
+/// GROUP BY columns. Aggregates other than COUNT, and grouping, are refused on encrypted columns,
+/// since SQL only ever sees their ciphertext
+///
+/// Example:
+/// ```
+/// let open = try await service.count(todos.query().where("is_completed", equals: false))
+///
+/// let perStatus = try await service.aggregate(
+///     todos.query().where("user_id", equals: userId).aggregate(.count(), .sum("estimate"), groupBy: ["status"])
+/// )
+/// ```
+public struct ZyraAggregateQuery {
+    public let query: ZyraQuery
+    public let aggregates: [ZyraAggregate]
+    public let groupBy: [String]
+
+    /// Values bound to the compiled SQL's placeholders, in order
+    public var parameters: [Any] {
+        return query.values
+    }
+
+    var shape: ZyraAggregateShape {
+        return ZyraAggregateShape(predicates: query.predicates, aggregates: aggregates, groupBy: groupBy)
+    }
+
+    /// Compiled SQL for this aggregate's shape, from the table's cache when it was compiled before
+    /// - Throws: `ZyraQueryError` when a column is not in the schema or cannot be aggregated
+    public func compile() throws -> ZyraCompiledAggregate {
+        let table = query.table
+        return try table.queryCache.compiled(for: shape) {
+            try ZyraAggregateQuery.build(shape: $0, table: table)
+        }
+    }
+
+    private static func build(shape: ZyraAggregateShape, table: ZyraTable) throws -> ZyraCompiledAggregate {
+        var terms: [String] = []
+        var kinds: [ZyraCompiledAggregate.Kind] = []
+
+        let groups = try shape.groupBy.map { try ZyraQuery.plainColumn($0, in: table) }
+        for (name, quoted) in zip(shape.groupBy, groups) {
+            terms.append(quoted)
+            kinds.append(kind(of: name, in: table))
+        }
+
+        for aggregate in shape.aggregates {
+            let argument: String
+            if let name = aggregate.column, aggregate.function == .count {
+                // Non-NULL counts hold on ciphertext; every other aggregate would compute on it
+                argument = try ZyraQuery.column(name, in: table)
+            } else if let name = aggregate.column {
+                argument = try ZyraQuery.plainColumn(name, in: table)
+            } else {
+                argument = "*"
+            }
+            terms.append("\(aggregate.function.rawValue)(\(argument)) AS \"\(aggregate.alias)\"")
+
+            switch aggregate.function {
+            case .count:
+                kinds.append(.integer)
+            case .average:
+                kinds.append(.double)
+            case .sum:
+                let summed = aggregate.column.map { kind(of: $0, in: table) }
+                kinds.append(summed == .integer ? .integer : .double)
+            case .min, .max:
+                kinds.append(aggregate.column.map { kind(of: $0, in: table) } ?? .text)
+            }
+        }
+
+        var sql = "SELECT \(terms.joined(separator: ", ")) FROM \"\(table.name)\""
+        sql += try ZyraQuery.whereClause(shape.predicates, table: table)
+        if !groups.isEmpty {
+            let grouping = groups.joined(separator: ", ")
+            sql += " GROUP BY \(grouping) ORDER BY \(grouping)"
+        }
+
+        return ZyraCompiledAggregate(
+            sql: sql,
+            layout: ZyraRowLayout(names: shape.groupBy + shape.aggregates.map { $0.alias }),
+            kinds: kinds
+        )
+    }
+
+    private static func kind(of column: String, in table: ZyraTable) -> ZyraCompiledAggregate.Kind {
+        switch table.column(named: column)?.swiftType {
+        case .integer?, .bigInt?:
+            return .integer
+        case .double?:
+            return .double
+        case .bool?:
+            return .boolean
+        default:
+            return .text
+        }
+    }
+}
+
+extension ZyraQuery {
+    /// Aggregate the rows matching this query's filters (see `ZyraAggregateQuery`)
+    /// - Parameters:
+    ///   - aggregates: Result columns, e.g. `.count()`, `.sum("estimate")`
+    ///   - groupBy: Columns to group by (empty = one row over every matching row)
+    public func aggregate(_ aggregates: ZyraAggregate..., groupBy: [String] = []) -> ZyraAggregateQuery {
+        return ZyraAggregateQuery(query: self, aggregates: aggregates, groupBy: groupBy)
+    }
+}
+
+// MARK: - Compiled Aggregates
+
+/// Parameterized SQL and result layout for one aggregate shape
+public struct ZyraCompiledAggregate: Sendable {
+    enum Kind {
+        case integer
+        case double
+        case text
+        case boolean
+    }
+
+    public let sql: String
+    /// Result columns: the GROUP BY columns, then the aggregate aliases
+    public let layout: ZyraRowLayout
+    let kinds: [Kind]
+
+    /// Read the current cursor row; values are plain SQL results, nothing to decrypt
+    func read(_ cursor: SqlCursor) -> ZyraRow {
+        var values = ContiguousArray<ZyraValue>(repeating: .null, count: kinds.count)
+        for (index, kind) in kinds.enumerated() {
+            switch kind {
+            case .integer:
+                values[index] = cursor.getIntOptional(index: index).map { .integer($0) } ?? .null
+            case .double:
+                values[index] = cursor.getDoubleOptional(index: index).map { .double($0) } ?? .null
+            case .text:
+                values[index] = cursor.getStringOptional(index: index).map { .text($0) } ?? .null
+            case .boolean:
+                values[index] = cursor.getStringOptional(index: index).map { .bool($0 == "true" || $0 == "1") } ?? .null
+            }
+        }
+        return ZyraRow(layout: layout, values: values)
+    }
+}
+
+/// Everything that determines a compiled aggregate
+struct ZyraAggregateShape: Hashable {
+    let predicates: [ZyraQuery.Predicate]
+    let aggregates: [ZyraAggregate]
+    let groupBy: [String]
+}
@@ -0,0 +1,32 @@
+//
+//  ZyraBlindIndex.swift
+//  ZyraForm
+//
+//  Equality lookups on encrypted columns through keyed HMAC tokens
+//
+
+import Foundation
+
+// MARK: - Blind Index Columns
+
+extension ZyraTable {
+    /// Name of the companion column holding a blind-indexed column's tokens
+    public static func blindIndexColumn(for column: String) -> String {
+        return "\(column)_bidx"
+    }
+}
+
+// MARK: - Query Values
+
+/// Plaintext filter value of a blind-indexed column, in a `ZyraQuery`'s parameters
+/// Tokens are keyed per user, so the query only records the plaintext and `ZyraSync`
+/// replaces it with the reading user's token right before the SQL runs
+struct ZyraBlindValue: CustomStringConvertible {
+    let field: String
+    let plaintext: String
+
+    /// Never print the plaintext of an encrypted column in logs
+    var description: String {
+        return "<blind index of \(field)>"
+    }
+}
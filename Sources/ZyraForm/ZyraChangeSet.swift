@@ -0,0 +1,252 @@
+//
+//  ZyraChangeSet.swift
+//  ZyraForm
+//
+//  Keyed incremental diffs between watch emissions
+//
+
+import Foundation
+
+// MARK: - Change Set
+
+/// A row affected by a change, identified by primary key
+/// `index` is the row's position in the new snapshot (inserted/updated) or in the previous one (removed)
+public struct ZyraRowChange: Equatable {
+    public let id: String
+    public let index: Int
+}
+
+/// A row that kept its primary key but changed position between snapshots
+public struct ZyraRowMove: Equatable {
+    public let id: String
+    public let from: Int
+    public let to: Int
+}
+
+/// Difference between two consecutive watch emissions, keyed by primary key
+/// A row is updated when any of its values changed, whether or not `updated_at` moved
+public struct ZyraChangeSet {
+    public let inserted: [ZyraRowChange]
+    public let updated: [ZyraRowChange]
+    public let removed: [ZyraRowChange]
+    public let moved: [ZyraRowMove]
+
+    /// True when the snapshot replaces everything seen before (first emission of a new query)
+    /// Consumers keeping their own list should rebuild it instead of applying the deltas
+    public let isReset: Bool
+
+    public var isEmpty: Bool {
+        return !isReset && inserted.isEmpty && updated.isEmpty && removed.isEmpty && moved.isEmpty
+    }
+
+    /// IDs whose row values must be (re)built: inserted and updated rows
+    public var changedIds: Set<String> {
+        return Set(inserted.map { $0.id } + updated.map { $0.id })
+    }
+}
+
+extension ZyraChangeSet {
+    /// Reset change set presenting every row of `rows` as inserted
+    /// Used to bring a late subscriber of a shared watch up to the current snapshot
+    init(resetTo rows: [ZyraRow], primaryKey: String) {
+        self.init(resetIds: rows.enumerated().map { index, row in
+            ZyraRowDiffer.key(for: row, at: index, primaryKey: primaryKey)
+        })
+    }
+    
+    /// Reset change set presenting every ID of `ids` as inserted, in order
+    init(resetIds ids: [String]) {
+        self.init(
+            inserted: ids.enumerated().map { ZyraRowChange(id: $1, index: $0) },
+            updated: [],
+            removed: [],
+            moved: [],
+            isReset: true
+        )
+    }
+}
+
+// MARK: - Row Differ
+
+/// Computes `ZyraChangeSet`s between emissions and keeps the previous snapshot
+/// so unchanged rows can be reused instead of being decoded again
+/// Thread-safe: the watch mapper reads from it off the main actor
+public final class ZyraRowDiffer: @unchecked Sendable {
+    public let primaryKey: String
+
+    private let lock = NSLock()
+    private var ids: [String] = []
+    private var rowsById: [String: ZyraRow] = [:]
+    /// Stored (pre-decryption) values of each row, when the snapshot was applied with them
+    private var storedById: [String: [ZyraRawValue]] = [:]
+    private var hasSnapshot = false
+
+    public init(primaryKey: String = "id") {
+        self.primaryKey = primaryKey
+    }
+
+    /// The previous row for `id` if its stored values are still `stored`, nil otherwise
+    public func unchangedRow(id: String, stored: [ZyraRawValue]) -> ZyraRow? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard let previous = storedById[id], previous == stored else {
+            return nil
+        }
+        return rowsById[id]
+    }
+
+    /// Diff `rows` against the previous snapshot and make them the new snapshot
+    /// - Parameter stored: The raw rows `rows` were decoded from, in the same order; kept so the
+    ///   next emission can reuse rows whose stored values did not change
+    public func apply(_ rows: [ZyraRow], stored: [ZyraRawRow] = []) -> ZyraChangeSet {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let isReset = !hasSnapshot
+        let hasStored = stored.count == rows.count
+
+        var newIds: [String] = []
+        newIds.reserveCapacity(rows.count)
+        var newRowsById = [String: ZyraRow](minimumCapacity: rows.count)
+        var newStoredById = [String: [ZyraRawValue]](minimumCapacity: hasStored ? rows.count : 0)
+        for (index, row) in rows.enumerated() {
+            let id = ZyraRowDiffer.key(for: row, at: index, primaryKey: primaryKey)
+            newIds.append(id)
+            newRowsById[id] = row
+            if hasStored {
+                newStoredById[id] = stored[index].values
+            }
+        }
+
+        let changes = ZyraRowDiffer.diff(from: ids, to: newIds, isReset: isReset) { id in
+            guard let previous = rowsById[id], let row = newRowsById[id] else { return true }
+            return previous != row
+        }
+
+        ids = newIds
+        rowsById = newRowsById
+        storedById = newStoredById
+        hasSnapshot = true
+
+        return changes
+    }
+
+    /// Keyed diff between two ordered ID lists
+    /// - Parameters:
+    ///   - oldIds: IDs of the previous snapshot, in order
+    ///   - newIds: IDs of the new snapshot, in order
+    ///   - isReset: Whether the new snapshot replaces everything seen before
+    ///   - isUpdated: Whether a row present in both snapshots changed
+    static func diff(
+        from oldIds: [String],
+        to newIds: [String],
+        isReset: Bool,
+        isUpdated: (String) -> Bool
+    ) -> ZyraChangeSet {
+        var oldIndexById = [String: Int](minimumCapacity: oldIds.count)
+        for (index, id) in oldIds.enumerated() {
+            oldIndexById[id] = index
+        }
+
+        var newIdSet = Set<String>(minimumCapacity: newIds.count)
+        var inserted: [ZyraRowChange] = []
+        var updated: [ZyraRowChange] = []
+
+        // Rows present in both snapshots, in new order: (id, old index, new index)
+        var survivors: [(id: String, from: Int, to: Int)] = []
+
+        for (index, id) in newIds.enumerated() {
+            newIdSet.insert(id)
+
+            if let oldIndex = oldIndexById[id] {
+                if isUpdated(id) {
+                    updated.append(ZyraRowChange(id: id, index: index))
+                }
+                survivors.append((id, oldIndex, index))
+            } else {
+                inserted.append(ZyraRowChange(id: id, index: index))
+            }
+        }
+
+        var removed: [ZyraRowChange] = []
+        for (index, id) in oldIds.enumerated() where !newIdSet.contains(id) {
+            removed.append(ZyraRowChange(id: id, index: index))
+        }
+
+        // Survivors on the longest increasing run of old indices kept their relative order;
+        // every other survivor moved
+        let stable = longestIncreasingSubsequence(survivors.map { $0.from })
+        var moved: [ZyraRowMove] = []
+        for (position, survivor) in survivors.enumerated() where !stable.contains(position) {
+            moved.append(ZyraRowMove(id: survivor.id, from: survivor.from, to: survivor.to))
+        }
+
+        return ZyraChangeSet(
+            inserted: inserted,
+            updated: updated,
+            removed: removed,
+            moved: moved,
+            isReset: isReset
+        )
+    }
+
+    /// Forget the previous snapshot; the next `apply` reports a reset
+    public func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        ids = []
+        rowsById = [:]
+        storedById = [:]
+        hasSnapshot = false
+    }
+
+    // MARK: - Helpers
+
+    static func key(for row: ZyraRow, at index: Int, primaryKey: String) -> String {
+        if let id = row.value(primaryKey).stringValue {
+            return id
+        }
+        // Rows without a primary key (e.g. aggregate queries) are keyed by position
+        return "#\(index)"
+    }
+
+    /// Positions (into `values`) of one longest strictly increasing subsequence
+    private static func longestIncreasingSubsequence(_ values: [Int]) -> Set<Int> {
+        guard !values.isEmpty else { return [] }
+
+        // tails[k] = position of the smallest tail of an increasing run of length k + 1
+        var tails: [Int] = []
+        var predecessors = [Int](repeating: -1, count: values.count)
+
+        for (position, value) in values.enumerated() {
+            var low = 0
+            var high = tails.count
+            while low < high {
+                let mid = (low + high) / 2
+                if values[tails[mid]] < value {
+                    low = mid + 1
+                } else {
+                    high = mid
+                }
+            }
+            if low > 0 {
+                predecessors[position] = tails[low - 1]
+            }
+            if low == tails.count {
+                tails.append(position)
+            } else {
+                tails[low] = position
+            }
+        }
+
+        var result = Set<Int>()
+        var position = tails.last!
+        while position >= 0 {
+            result.insert(position)
+            position = predecessors[position]
+        }
+        return result
+    }
+}
@@ -0,0 +1,65 @@
+//
+//  ZyraDecodeExecutor.swift
+//  ZyraForm
+//
+//  Parallel chunked decoding of watch results off the main actor
+//
+
+import Foundation
+
+/// Decrypts and converts raw rows in parallel chunks across cores
+/// Rows are split into contiguous chunks, each finished by its own child task,
+/// and the results are stitched back together in the original order
+public struct ZyraDecodeExecutor: Sendable {
+    /// Number of chunks decoded at the same time
+    public let concurrency: Int
+
+    /// Result sets smaller than this are decoded on the calling task; splitting them costs more than it saves
+    public let minimumChunkSize: Int
+
+    /// Executor sized to the machine's active cores
+    public static let shared = ZyraDecodeExecutor()
+
+    public init(
+        concurrency: Int = ProcessInfo.processInfo.activeProcessorCount,
+        minimumChunkSize: Int = 512
+    ) {
+        self.concurrency = max(1, concurrency)
+        self.minimumChunkSize = max(1, minimumChunkSize)
+    }
+
+    /// Finish `rows` with `decoder`, in order
+    public func decode(_ rows: [ZyraRawRow], with decoder: ZyraRowDecoder) async -> [ZyraRow] {
+        let chunkCount = min(concurrency, rows.count / minimumChunkSize)
+        guard chunkCount > 1 else {
+            return decoder.finish(rows)
+        }
+
+        let chunkSize = (rows.count + chunkCount - 1) / chunkCount
+
+        let chunks = await withTaskGroup(of: (Int, [ZyraRow]).self) { group -> [[ZyraRow]] in
+            for chunk in 0..<chunkCount {
+                let start = chunk * chunkSize
+                let end = min(start + chunkSize, rows.count)
+                guard start < end else { continue }
+
+                group.addTask {
+                    return (chunk, decoder.finish(rows[start..<end]))
+                }
+            }
+
+            var chunks = [[ZyraRow]](repeating: [], count: chunkCount)
+            for await (chunk, decoded) in group {
+                chunks[chunk] = decoded
+            }
+            return chunks
+        }
+
+        var result: [ZyraRow] = []
+        result.reserveCapacity(rows.count)
+        for chunk in chunks {
+            result.append(contentsOf: chunk)
+        }
+        return result
+    }
+}
@@ -0,0 +1,340 @@
+//
+//  ZyraDecodePlan.swift
+//  ZyraForm
+//
+//  Precompiled per-query row decoding for PowerSync cursors
+//
+
+import Foundation
+import PowerSync
+
+// MARK: - Decode Plan
+
+/// Precompiled decode plan for a query
+/// Built once per query from the field configuration so the per-row mapper
+/// does no set lookups and no try/fail type probing
+public struct ZyraDecodePlan: Hashable {
+    /// How a column's value is read from the cursor
+    public enum StorageType: Hashable {
+        case text
+        case integer
+        case boolean
+    }
+
+    /// Whether a column's stored value must be decrypted before conversion
+    public enum DecryptMode: Hashable {
+        case none
+        case perUser
+    }
+
+    /// A single column of the plan
+    public struct Column: Hashable {
+        public let name: String
+        public let storage: StorageType
+        public let decrypt: DecryptMode
+        /// Cursor index when the SELECT list fixes it, nil when resolved from the cursor's column names
+        public let index: Int?
+    }
+
+    public let columns: [Column]
+
+    /// Whether every column index is known without looking at the cursor
+    public var hasFixedIndices: Bool {
+        return columns.allSatisfy { $0.index != nil }
+    }
+
+    /// Compile a plan from field lists
+    /// - Parameters:
+    ///   - fields: Field names to read from each row
+    ///   - encryptedFields: Field names that should be decrypted
+    ///   - integerFields: Field names that are integers
+    ///   - booleanFields: Field names that are booleans
+    ///   - fieldsMatchSelectOrder: Pass true when `fields` is exactly the SELECT list, so indices can be fixed up front
+    public init(
+        fields: [String],
+        encryptedFields: [String] = [],
+        integerFields: [String] = [],
+        booleanFields: [String] = [],
+        fieldsMatchSelectOrder: Bool = false
+    ) {
+        let encrypted = Set(encryptedFields)
+        let integers = Set(integerFields)
+        let booleans = Set(booleanFields)
+
+        self.columns = fields.enumerated().map { offset, name in
+            let storage: StorageType
+            if integers.contains(name) {
+                storage = .integer
+            } else if booleans.contains(name) {
+                storage = .boolean
+            } else {
+                storage = .text
+            }
+
+            return Column(
+                name: name,
+                storage: storage,
+                decrypt: encrypted.contains(name) ? .perUser : .none,
+                index: fieldsMatchSelectOrder ? offset : nil
+            )
+        }
+    }
+
+    /// Compile a plan from a table's field configuration
+    /// - Parameters:
+    ///   - config: Field configuration generated by `ZyraTable.toTableFieldConfig()`
+    ///   - fields: Field names to read (nil = all fields)
+    ///   - fieldsMatchSelectOrder: Pass true when `fields` is exactly the SELECT list
+    public init(config: TableFieldConfig, fields: [String]? = nil, fieldsMatchSelectOrder: Bool = false) {
+        self.init(
+            fields: fields ?? config.allFields,
+            encryptedFields: config.encryptedFields,
+            integerFields: config.integerFields,
+            booleanFields: config.booleanFields,
+            fieldsMatchSelectOrder: fieldsMatchSelectOrder
+        )
+    }
+}
+
+// MARK: - Raw Rows
+
+/// A value as stored in SQLite, before decryption and conversion
+public enum ZyraRawValue: Equatable {
+    case null
+    case integer(Int)
+    case text(String)
+}
+
+/// A cursor row captured by `ZyraRowDecoder.read(_:)`, in bound column order
+/// Immutable once read, so it can be handed to decode tasks
+public struct ZyraRawRow: @unchecked Sendable {
+    let id: String?
+    let version: String?
+    let values: [ZyraRawValue]
+    /// Previously decoded row, set when the row's stored values are unchanged since the last emission
+    let reused: ZyraRow?
+}
+
+// MARK: - Row Decoder
+
+/// Decodes cursor rows with a precompiled `ZyraDecodePlan`
+/// Column indices are resolved once (on the first row when the SELECT list is not known)
+/// and reused for every following row of the query
+public final class ZyraRowDecoder: @unchecked Sendable {
+    public let plan: ZyraDecodePlan
+    /// Column names shared by every decoded row; ordinals are positions in `plan.columns`
+    public let layout: ZyraRowLayout
+    private let userId: String
+    private let encryptionManager: SecureEncryptionManager
+    private let primaryKey: String
+    private let versionKey: String
+    private let rowReuse: ZyraRowDiffer?
+    private let decryptCache: ZyraDecryptCache?
+
+    private struct BoundColumn {
+        let name: String
+        /// Position in `plan.columns` (and in the row layout)
+        let ordinal: Int
+        let index: Int
+        let storage: ZyraDecodePlan.StorageType
+        let decrypt: ZyraDecodePlan.DecryptMode
+    }
+
+    private struct Binding {
+        let columns: [BoundColumn]
+        /// Cursor indices of the primary key and version columns, used for row reuse and the decrypt cache
+        let idIndex: Int?
+        let versionIndex: Int?
+    }
+
+    private let lock = NSLock()
+    private var binding: Binding?
+
+    /// - Parameters:
+    ///   - plan: Precompiled plan for the query
+    ///   - userId: User whose key decrypts per-user encrypted columns
+    ///   - encryptionManager: Encryption manager used for decryption
+    ///   - primaryKey: Column identifying a row
+    ///   - versionKey: Column that changes whenever a row changes
+    ///   - rowReuse: Differ holding the previous emission; rows whose primary key and stored
+    ///     values are unchanged are returned from it without being decrypted or converted again
+    ///   - decryptCache: Cache of decrypted values keyed by primary key and version
+    public init(
+        plan: ZyraDecodePlan,
+        userId: String,
+        encryptionManager: SecureEncryptionManager,
+        primaryKey: String = "id",
+        versionKey: String = "updated_at",
+        rowReuse: ZyraRowDiffer? = nil,
+        decryptCache: ZyraDecryptCache? = nil
+    ) {
+        self.plan = plan
+        self.layout = ZyraRowLayout(names: plan.columns.map { $0.name })
+        self.userId = userId
+        self.encryptionManager = encryptionManager
+        self.primaryKey = primaryKey
+        self.versionKey = versionKey
+        self.rowReuse = rowReuse
+        self.decryptCache = decryptCache
+
+        if plan.hasFixedIndices {
+            self.binding = makeBinding(plan.columns.map { $0.index })
+        }
+    }
+
+    private func makeBinding(_ ordinalIndices: [Int?]) -> Binding {
+        let columns = zip(plan.columns, ordinalIndices).enumerated().compactMap { ordinal, pair -> BoundColumn? in
+            let (column, index) = pair
+            guard let index = index else { return nil }
+            return BoundColumn(name: column.name, ordinal: ordinal, index: index, storage: column.storage, decrypt: column.decrypt)
+        }
+        let plainColumn = { (name: String) -> Int? in
+            return columns.first { $0.name == name && $0.decrypt == .none }?.index
+        }
+        return Binding(
+            columns: columns,
+            idIndex: plainColumn(primaryKey),
+            versionIndex: plainColumn(versionKey)
+        )
+    }
+
+    /// Resolve column indices against the cursor, once per query
+    /// Columns missing from the result set are dropped from the bound plan
+    private func bind(to cursor: SqlCursor) -> Binding {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let binding = binding {
+            return binding
+        }
+
+        let columnNames = cursor.columnNames
+        let bound = makeBinding(plan.columns.map { $0.index ?? columnNames[$0.name] })
+        binding = bound
+        return bound
+    }
+
+    /// Decode the current cursor row
+    public func decodeRow(_ cursor: SqlCursor) -> ZyraRow {
+        let raw = read(cursor)
+        if let reused = raw.reused {
+            return reused
+        }
+        return convert(raw, columns: bind(to: cursor).columns)
+    }
+
+    /// Decode the current cursor row into a record dictionary
+    public func decode(_ cursor: SqlCursor) -> [String: Any] {
+        return decodeRow(cursor).dictionary
+    }
+
+    /// Read the current cursor row without decrypting or converting it
+    /// Cheap enough to run inside the PowerSync mapper; `finish(_:)` does the
+    /// decrypt/convert work afterwards, off the cursor and possibly in parallel
+    public func read(_ cursor: SqlCursor) -> ZyraRawRow {
+        let binding = bind(to: cursor)
+        let id = binding.idIndex.flatMap { cursor.getStringOptional(index: $0) }
+        let version = binding.versionIndex.flatMap { cursor.getStringOptional(index: $0) }
+
+        var values: [ZyraRawValue] = []
+        values.reserveCapacity(binding.columns.count)
+
+        for column in binding.columns {
+            if column.decrypt == .none && column.storage == .integer {
+                values.append(cursor.getIntOptional(index: column.index).map { .integer($0) } ?? .null)
+            } else {
+                // Encrypted values are ciphertext text; booleans arrive either as integers (1/0)
+                // or as "true"/"false" text, and reading the text form covers both in a single call
+                values.append(cursor.getStringOptional(index: column.index).map { .text($0) } ?? .null)
+            }
+        }
+
+        // Rows whose stored values are all unchanged are reused as-is; `updated_at` alone is not
+        // enough (one-second resolution, writes without autoTimestamp, server edits)
+        if let rowReuse = rowReuse,
+           let id = id,
+           let previous = rowReuse.unchangedRow(id: id, stored: values) {
+            return ZyraRawRow(id: id, version: version, values: values, reused: previous)
+        }
+
+        return ZyraRawRow(id: id, version: version, values: values, reused: nil)
+    }
+
+    /// Decrypt and convert raw rows read by `read(_:)` into decoded rows
+    /// Safe to call concurrently from several tasks on disjoint slices
+    public func finish<Rows: Collection>(_ rows: Rows) -> [ZyraRow] where Rows.Element == ZyraRawRow {
+        var result: [ZyraRow] = []
+        result.reserveCapacity(rows.count)
+
+        var columns: [BoundColumn]?
+        for raw in rows {
+            if let reused = raw.reused {
+                result.append(reused)
+                continue
+            }
+            if columns == nil {
+                columns = currentColumns()
+            }
+            result.append(convert(raw, columns: columns ?? []))
+        }
+        return result
+    }
+
+    private func currentColumns() -> [BoundColumn] {
+        lock.lock()
+        defer { lock.unlock() }
+        return binding?.columns ?? []
+    }
+
+    private func convert(_ raw: ZyraRawRow, columns: [BoundColumn]) -> ZyraRow {
+        var values = ContiguousArray<ZyraValue>(repeating: .null, count: plan.columns.count)
+
+        for (column, value) in zip(columns, raw.values) {
+            switch value {
+            case .null:
+                continue
+            case .integer(let intValue):
+                values[column.ordinal] = .integer(intValue)
+            case .text(let text):
+                if column.decrypt == .perUser {
+                    guard let decrypted = decrypt(text, field: column.name, id: raw.id, version: raw.version) else {
+                        values[column.ordinal] = .text(text)
+                        continue
+                    }
+
+                    switch column.storage {
+                    case .integer:
+                        values[column.ordinal] = Int(decrypted).map { .integer($0) } ?? .text(decrypted)
+                    case .boolean:
+                        values[column.ordinal] = .bool(decrypted == "true" || decrypted == "1")
+                    case .text:
+                        values[column.ordinal] = .text(decrypted)
+                    }
+                } else if column.storage == .boolean {
+                    values[column.ordinal] = .bool(text == "true" || text == "1")
+                } else {
+                    values[column.ordinal] = .text(text)
+                }
+            }
+        }
+
+        return ZyraRow(layout: layout, values: values)
+    }
+
+    /// Decrypt a stored value, going through the decrypt cache when the row is identifiable
+    func decrypt(_ encryptedValue: String, field: String, id: String?, version: String?) -> String? {
+        guard let decryptCache = decryptCache, let id = id, let version = version else {
+            return try? encryptionManager.decryptIfEnabled(encryptedValue, for: userId)
+        }
+
+        if let cached = decryptCache.plaintext(id: id, version: version, field: field, ciphertext: encryptedValue, userId: userId) {
+            return cached
+        }
+
+        guard let decrypted = try? encryptionManager.decryptIfEnabled(encryptedValue, for: userId) else {
+            return nil
+        }
+        decryptCache.store(decrypted, id: id, version: version, field: field, ciphertext: encryptedValue, userId: userId)
+        return decrypted
+    }
+}
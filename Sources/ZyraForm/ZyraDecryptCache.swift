@@ -0,0 +1,209 @@
+//
+//  ZyraDecryptCache.swift
+//  ZyraForm
+//
+//  Bounded LRU cache of decrypted field values across watch emissions
+//
+
+import Foundation
+
+/// Bounded LRU cache of decrypted field values for one table
+/// Rows are keyed by primary key and `updated_at`; each cached field also keeps its ciphertext,
+/// so a hit is only served when the stored value is byte-for-byte the one that was decrypted
+/// Shared by every service reading the same table, see `ZyraDecryptCache.shared(for:)`
+public final class ZyraDecryptCache: @unchecked Sendable {
+    // MARK: - Registry
+
+    /// Default maximum number of rows kept per table
+    public static let defaultCapacity = 10_000
+
+    private static let registryLock = NSLock()
+    private static var caches: [String: ZyraDecryptCache] = [:]
+
+    /// The cache shared by all services for `table`
+    public static func shared(for table: String) -> ZyraDecryptCache {
+        registryLock.lock()
+        defer { registryLock.unlock() }
+
+        if let cache = caches[table] {
+            return cache
+        }
+        let cache = ZyraDecryptCache(table: table)
+        caches[table] = cache
+        return cache
+    }
+
+    /// Drop every cached plaintext for every table
+    /// Called when encryption keys change (`clearAllKeys`, `importMasterKey`)
+    public static func invalidateAll() {
+        registryLock.lock()
+        let all = Array(caches.values)
+        registryLock.unlock()
+
+        for cache in all {
+            cache.removeAll()
+        }
+    }
+
+    // MARK: - Entries
+
+    private struct Key: Hashable {
+        let id: String
+        let version: String
+    }
+
+    private struct CachedField {
+        let ciphertext: String
+        let plaintext: String
+    }
+
+    /// LRU list node stored inline in `entries`; `previous`/`next` are indices (-1 = none)
+    private struct Entry {
+        var key: Key
+        var fields: [String: CachedField]
+        var previous: Int
+        var next: Int
+    }
+
+    public let table: String
+    public let capacity: Int
+
+    private let lock = NSLock()
+    private var entries: [Entry] = []
+    private var indexByKey: [Key: Int] = [:]
+    private var head = -1 // most recently used
+    private var tail = -1 // least recently used
+    private var userId: String?
+    private var hitCount = 0
+    private var missCount = 0
+
+    public init(table: String, capacity: Int = ZyraDecryptCache.defaultCapacity) {
+        self.table = table
+        self.capacity = max(1, capacity)
+    }
+
+    // MARK: - Statistics
+
+    /// Number of lookups served from the cache
+    public var hits: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return hitCount
+    }
+
+    /// Number of lookups that required decryption
+    public var misses: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return missCount
+    }
+
+    /// Number of rows currently cached
+    public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return indexByKey.count
+    }
+
+    // MARK: - Lookup
+
+    /// Cached plaintext for `field` of row (`id`, `version`), or nil on a miss
+    /// A lookup for a different user than the cached one drops the cache first
+    public func plaintext(id: String, version: String, field: String, ciphertext: String, userId: String) -> String? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        switchUser(to: userId)
+
+        guard let index = indexByKey[Key(id: id, version: version)],
+              let cached = entries[index].fields[field],
+              cached.ciphertext == ciphertext else {
+            missCount += 1
+            return nil
+        }
+
+        hitCount += 1
+        moveToFront(index)
+        return cached.plaintext
+    }
+
+    /// Store the plaintext decrypted for `field` of row (`id`, `version`)
+    public func store(_ plaintext: String, id: String, version: String, field: String, ciphertext: String, userId: String) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        switchUser(to: userId)
+
+        let key = Key(id: id, version: version)
+        let cached = CachedField(ciphertext: ciphertext, plaintext: plaintext)
+
+        if let index = indexByKey[key] {
+            entries[index].fields[field] = cached
+            moveToFront(index)
+            return
+        }
+
+        let index: Int
+        if entries.count < capacity {
+            index = entries.count
+            entries.append(Entry(key: key, fields: [field: cached], previous: -1, next: -1))
+        } else {
+            // Reuse the least recently used slot
+            index = tail
+            unlink(index)
+            indexByKey[entries[index].key] = nil
+            entries[index] = Entry(key: key, fields: [field: cached], previous: -1, next: -1)
+        }
+        indexByKey[key] = index
+        linkAtFront(index)
+    }
+
+    /// Drop all cached values and reset the statistics
+    public func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        clear()
+        hitCount = 0
+        missCount = 0
+    }
+
+    // MARK: - LRU Helpers (lock must be held)
+
+    private func switchUser(to newUserId: String) {
+        if userId != newUserId {
+            clear()
+            userId = newUserId
+        }
+    }
+
+    private func clear() {
+        entries.removeAll(keepingCapacity: true)
+        indexByKey.removeAll(keepingCapacity: true)
+        head = -1
+        tail = -1
+    }
+
+    private func unlink(_ index: Int) {
+        let previous = entries[index].previous
+        let next = entries[index].next
+        if previous >= 0 { entries[previous].next = next } else { head = next }
+        if next >= 0 { entries[next].previous = previous } else { tail = previous }
+        entries[index].previous = -1
+        entries[index].next = -1
+    }
+
+    private func linkAtFront(_ index: Int) {
+        entries[index].previous = -1
+        entries[index].next = head
+        if head >= 0 { entries[head].previous = index }
+        head = index
+        if tail < 0 { tail = index }
+    }
+
+    private func moveToFront(_ index: Int) {
+        guard head != index else { return }
+        unlink(index)
+        linkAtFront(index)
+    }
+}
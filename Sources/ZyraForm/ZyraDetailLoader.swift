@@ -0,0 +1,171 @@
+//
+//  ZyraDetailLoader.swift
+//  ZyraForm
+//
+//  On-demand loading of the columns a list projection leaves out
+//
+
+import Foundation
+
+/// Loads a table's detail columns (see `ZyraTable.listFields`) for records as they are opened
+/// Requests made together are batched into one `WHERE pk IN (...)` query, and every fetched row is
+/// memoized until the record's `updated_at` changes. List watches then only read and decrypt the
+/// listed columns; the rest are decrypted once per record version, when something first needs them
+@MainActor
+public final class ZyraDetailLoader {
+    public let table: ZyraTable
+
+    /// Columns each detail row holds: the primary key, `updated_at`, then the requested columns
+    public let fields: [String]
+
+    /// Ids per query, below SQLite's default limit of 999 host parameters
+    static let maxBatchSize = 900
+
+    private let service: ZyraSync
+    private let plan: ZyraDecodePlan
+    private let selectSQL: String
+    private var memo: [String: ZyraRow] = [:]
+    private var waiting: [String: [CheckedContinuation<ZyraRow?, Error>]] = [:]
+    private var isFlushScheduled = false
+
+    /// Queries run so far (one per batch of at most `maxBatchSize` ids)
+    public private(set) var queryCount = 0
+
+    /// - Parameters:
+    ///   - service: Service reading the table, whose user and keys decrypt the rows
+    ///   - table: Schema of the table
+    ///   - fields: Columns to load besides the primary key and `updated_at`
+    public init(service: ZyraSync, table: ZyraTable, fields: [String]) {
+        var selected = [table.primaryKey, "updated_at"]
+        selected.append(contentsOf: fields.filter { !selected.contains($0) })
+
+        self.service = service
+        self.table = table
+        self.fields = selected
+        self.plan = ZyraDecodePlan(config: table.fieldConfig, fields: selected, fieldsMatchSelectOrder: true)
+        self.selectSQL = "SELECT \(selected.map { "\"\($0)\"" }.joined(separator: ", ")) FROM \"\(service.table)\""
+    }
+
+    /// Number of memoized rows
+    public var count: Int {
+        return memo.count
+    }
+
+    // MARK: - Loading
+
+    /// Detail row of one record
+    /// Calls made before the loader next runs share a single query
+    /// - Parameters:
+    ///   - id: Primary key of the record
+    ///   - version: `updated_at` the caller holds; a memoized row with another version is refetched (nil = any)
+    /// - Returns: The row, or nil when no record has this id
+    public func row(id: String, version: String?) async throws -> ZyraRow? {
+        if let cached = memo[id], isCurrent(cached, version: version) {
+            return cached
+        }
+
+        return try await withCheckedThrowingContinuation { continuation in
+            waiting[id, default: []].append(continuation)
+            scheduleFlush()
+        }
+    }
+
+    /// Detail rows of several records in one batched read
+    /// - Parameter versions: `updated_at` by id, for the ids whose version the caller holds
+    /// - Returns: Rows by id; ids with no record are absent
+    public func rows(ids: [String], versions: [String: String] = [:]) async throws -> [String: ZyraRow] {
+        var result = [String: ZyraRow](minimumCapacity: ids.count)
+        var missing: [String] = []
+        for id in ids {
+            if let cached = memo[id], isCurrent(cached, version: versions[id]) {
+                result[id] = cached
+            } else {
+                missing.append(id)
+            }
+        }
+
+        if !missing.isEmpty {
+            for (id, row) in try await fetch(ids: missing) {
+                result[id] = row
+            }
+        }
+        return result
+    }
+
+    /// Drop memoized rows (nil = all of them)
+    public func invalidate(ids: [String]? = nil) {
+        guard let ids = ids else {
+            memo.removeAll()
+            return
+        }
+        for id in ids {
+            memo[id] = nil
+        }
+    }
+
+    // MARK: - Batching
+
+    private func isCurrent(_ row: ZyraRow, version: String?) -> Bool {
+        guard let version = version else { return true }
+        return row.string("updated_at") == version
+    }
+
+    private func scheduleFlush() {
+        guard !isFlushScheduled else { return }
+        isFlushScheduled = true
+
+        Task { [self] in
+            // Let requests issued in the same pass join the batch
+            await Task.yield()
+            await flush()
+        }
+    }
+
+    private func flush() async {
+        isFlushScheduled = false
+        let batch = waiting
+        waiting = [:]
+        guard !batch.isEmpty else { return }
+
+        do {
+            let rows = try await fetch(ids: Array(batch.keys))
+            for (id, continuations) in batch {
+                for continuation in continuations {
+                    continuation.resume(returning: rows[id])
+                }
+            }
+        } catch {
+            for continuations in batch.values {
+                for continuation in continuations {
+                    continuation.resume(throwing: error)
+                }
+            }
+        }
+    }
+
+    /// Read and memoize the rows of `ids`, at most `maxBatchSize` ids per query
+    private func fetch(ids: [String]) async throws -> [String: ZyraRow] {
+        let primaryKey = table.primaryKey
+        var fetched = [String: ZyraRow](minimumCapacity: ids.count)
+
+        for start in stride(from: 0, to: ids.count, by: ZyraDetailLoader.maxBatchSize) {
+            let chunk = Array(ids[start..<min(start + ZyraDetailLoader.maxBatchSize, ids.count)])
+            let placeholders = Array(repeating: "?", count: chunk.count).joined(separator: ", ")
+            let rows = try await service.fetch(
+                sql: "\(selectSQL) WHERE \"\(primaryKey)\" IN (\(placeholders))",
+                parameters: chunk,
+                plan: plan
+            )
+            queryCount += 1
+
+            for row in rows {
+                guard let id = row.value(primaryKey).stringValue else { continue }
+                memo[id] = row
+                fetched[id] = row
+            }
+        }
+
+        ZyraFormLogger.debug("📥 Loaded detail columns of \(fetched.count) \(table.name) records")
+        return fetched
+    }
+}
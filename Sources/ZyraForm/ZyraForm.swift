@@ -212,7 +212,7 @@ public class ZyraForm<Values: FormValues>: ObservableObject {
     // MARK: - Values Management
     
     public func setValue(_ value: Any?, for field: String) {
-        guard let column = schema.columns.first(where: { $0.name == field }) else { return }
+        guard let column = schema.column(named: field) else { return }
         
         // Update values dictionary
         var dict = values.toDictionary()
@@ -291,7 +291,7 @@ public class ZyraForm<Values: FormValues>: ObservableObject {
     
     @discardableResult
     public func validateField(_ field: String) -> Bool {
-        guard let column = schema.columns.first(where: { $0.name == field }) else { return true }
+        guard let column = schema.column(named: field) else { return true }
         
         let value = getValue(for: field)
         let error = ZyraValidation.validate(value, against: column)
@@ -378,20 +378,22 @@ public class ZyraForm<Values: FormValues>: ObservableObject {
         service: ZyraSync,
         fields: [String]? = nil
     ) async throws {
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         let fieldsToLoad = fields ?? config.allFields
         
-        try await service.loadRecords(
+        // Single read; does not start or replace the service's watch
+        let record = try await service.fetchRecords(
             fields: fieldsToLoad,
             whereClause: "id = ?",
             parameters: [recordId],
             orderBy: config.defaultOrderBy,
+            limit: 1,
             encryptedFields: config.encryptedFields,
             integerFields: config.integerFields,
             booleanFields: config.booleanFields
-        )
+        ).first
         
-        guard let record = service.records.first else {
+        guard let record = record else {
             throw NSError(domain: "ZyraForm", code: 404, userInfo: [NSLocalizedDescriptionKey: "Record not found"])
         }
         
@@ -413,7 +415,7 @@ public class ZyraForm<Values: FormValues>: ObservableObject {
         var dict: [String: Any] = [:]
         
         for column in schema.columns {
-            if let value = record[column.name] {
+            if let value = record[column.name], !(value is NSNull) {
                 dict[column.name] = value
             }
         }
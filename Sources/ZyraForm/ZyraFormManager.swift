@@ -44,6 +44,15 @@ public class ZyraFormManager {
         
         shared = ZyraFormManager(config: config)
         
+        // Search indexes are a local convenience: without them only search() fails, so keep going
+        if let manager = shared {
+            do {
+                try await config.schema.installSearchIndexes(on: manager.database)
+            } catch {
+                ZyraFormLogger.error("❌ Failed to install search indexes: \(error.localizedDescription)")
+            }
+        }
+        
         // Connect to PowerSync
         do {
             ZyraFormLogger.info("🔄 Connecting to PowerSync...")
@@ -18,6 +18,11 @@ public protocol ZyraModel: Codable, Identifiable {
     /// Initialize from a database record dictionary
     init(from record: [String: Any]) throws
     
+    /// Initialize from a decoded row, reading columns by schema ordinal
+    /// Optional: the default implementation goes through `init(from:)`;
+    /// models generated by `ZyraTable.generateSwiftModel` implement it directly
+    init(row: ZyraModelRow) throws
+    
     /// Convert to dictionary for database operations
     func toDictionary(excluding columns: [String]) -> [String: Any]
 }
@@ -25,9 +30,25 @@ public protocol ZyraModel: Codable, Identifiable {
 // MARK: - ZyraModel Default Implementation
 
 extension ZyraModel {
+    /// Decode through the record dictionary
+    public init(row: ZyraModelRow) throws {
+        try self.init(from: row.dictionary())
+    }
+    
+    /// Decode plan over all schema columns in schema order, matching the ordinals used by `init(row:)`
+    /// - Parameter fieldsMatchSelectOrder: Pass true when the SELECT list is exactly the schema columns in order
+    public static func decodePlan(fieldsMatchSelectOrder: Bool = false) -> ZyraDecodePlan {
+        return ZyraDecodePlan(config: schema.fieldConfig, fieldsMatchSelectOrder: fieldsMatchSelectOrder)
+    }
+    
+    /// Start a typed query against the model's table
+    public static func query() -> ZyraQuery {
+        return schema.query()
+    }
+    
     /// Get validation rules for a specific field from the schema
     public static func validationRules(for field: String) -> ColumnMetadata? {
-        return schema.columns.first(where: { $0.name == field })
+        return schema.column(named: field)
     }
     
     /// Get all field names from the schema
@@ -85,8 +106,8 @@ extension ZyraModel {
             return value
         }
         
-        // Handle nil values
-        guard let value = value else {
+        // Handle nil values (NSNull is a null column of a record)
+        guard let value = value, !(value is NSNull) else {
             return column.isNullable ? nil : (column.defaultValue ?? nil)
         }
         
@@ -122,7 +143,7 @@ extension ZyraModel {
             if let dateValue = value as? Date {
                 return dateValue
             } else if let strValue = value as? String {
-                return ISO8601DateFormatter().date(from: strValue)
+                return ZyraTimestamp.date(from: strValue)
             }
             return nil
             
@@ -0,0 +1,156 @@
+//
+//  ZyraModelRow.swift
+//  ZyraForm
+//
+//  Typed ordinal access for decoding rows straight into ZyraModel structs
+//
+
+import Foundation
+
+/// One decoded row handed to `ZyraModel.init(row:)`
+/// Values are addressed by column ordinal (position in the row's layout, which for models is the schema column
+/// order), so generated `init(row:)` initializers read each column by index with no dictionary in between.
+/// Rows come already decrypted and converted by `ZyraRowDecoder`
+public struct ZyraModelRow {
+    private let row: ZyraRow
+
+    /// Primary key of the row
+    public let id: String?
+
+    /// `updated_at` of the row
+    public let version: String?
+
+    /// A row decoded by `ZyraRowDecoder`; ordinals are positions in its layout
+    /// - Parameters:
+    ///   - row: Decoded (decrypted and converted) row
+    ///   - primaryKey: Column identifying the row
+    ///   - versionKey: Column that changes whenever the row changes
+    public init(row: ZyraRow, primaryKey: String = "id", versionKey: String = "updated_at") {
+        self.row = row
+        self.id = row.value(primaryKey).stringValue
+        self.version = row.string(versionKey)
+    }
+
+    // MARK: - Typed Accessors
+
+    /// Text value of the column
+    public func string(_ ordinal: Int) -> String? {
+        return value(ordinal)?.stringValue
+    }
+
+    /// Integer value of the column
+    public func int(_ ordinal: Int) -> Int? {
+        return value(ordinal)?.intValue
+    }
+
+    /// 64-bit integer value of the column
+    public func int64(_ ordinal: Int) -> Int64? {
+        return value(ordinal)?.intValue.map { Int64($0) }
+    }
+
+    /// Floating point value of the column
+    public func double(_ ordinal: Int) -> Double? {
+        return value(ordinal)?.doubleValue
+    }
+
+    /// Boolean value of the column; stored as "true"/"false" text or 1/0
+    public func bool(_ ordinal: Int) -> Bool? {
+        guard let text = string(ordinal) else { return nil }
+        return text.lowercased() == "true" || text == "1"
+    }
+
+    /// Date value of the column, parsed from ISO 8601 text
+    public func date(_ ordinal: Int) -> Date? {
+        return string(ordinal).flatMap { ZyraTimestamp.date(from: $0) }
+    }
+
+    /// Decimal value of the column, parsed from its text form
+    public func decimal(_ ordinal: Int) -> Decimal? {
+        return string(ordinal).flatMap { Decimal(string: $0) }
+    }
+
+    /// The row as a record dictionary, for models without a generated `init(row:)`
+    public func dictionary() -> [String: Any] {
+        return row.dictionary
+    }
+
+    // MARK: - Helpers
+
+    private func value(_ ordinal: Int) -> ZyraValue? {
+        guard ordinal >= 0, ordinal < row.values.count else { return nil }
+        return row[ordinal]
+    }
+}
+
+// MARK: - Model Decoder
+
+/// Builds `Model` values from the decoded rows of one watch emission with `init(row:)`
+/// Rows the emission's change set names as inserted or updated (every row on a reset) are built again;
+/// the others keep their model from the previous emission, so each emission only builds the rows that changed.
+/// Emissions are applied one at a time on the consumer side, after `ZyraRowDiffer.apply` produced their
+/// change set; nothing is carried over from the PowerSync mapper
+public final class ZyraModelDecoder<Model: ZyraModel> {
+    public let primaryKey: String
+    public let versionKey: String
+
+    private var models: [String: (version: String?, model: Model)] = [:]
+
+    /// Row keys of the last applied emission, in order
+    public private(set) var committedIds: [String] = []
+
+    /// - Parameters:
+    ///   - primaryKey: Column identifying a row
+    ///   - versionKey: Column that changes whenever a row changes
+    public init(primaryKey: String = "id", versionKey: String = "updated_at") {
+        self.primaryKey = primaryKey
+        self.versionKey = versionKey
+    }
+
+    /// Models of one emission, in row order
+    /// - Parameters:
+    ///   - rows: Decoded rows of the emission
+    ///   - changes: Changes of `rows` against the previous emission, as computed by `ZyraRowDiffer`
+    /// - Throws: Errors from `Model.init(row:)`; the previous emission stays applied
+    public func apply(_ rows: [ZyraRow], changes: ZyraChangeSet) throws -> [Model] {
+        let changed = changes.changedIds
+
+        var result: [Model] = []
+        result.reserveCapacity(rows.count)
+        var ids: [String] = []
+        ids.reserveCapacity(rows.count)
+        var next = [String: (version: String?, model: Model)](minimumCapacity: rows.count)
+
+        for (index, row) in rows.enumerated() {
+            let id = ZyraRowDiffer.key(for: row, at: index, primaryKey: primaryKey)
+            let model: Model
+            if !changes.isReset, !changed.contains(id), let previous = models[id] {
+                model = previous.model
+            } else {
+                model = try Model(row: ZyraModelRow(row: row, primaryKey: primaryKey, versionKey: versionKey))
+            }
+            result.append(model)
+            ids.append(id)
+            next[id] = (row.string(versionKey), model)
+        }
+
+        models = next
+        committedIds = ids
+        return result
+    }
+
+    /// Model of a row in the last applied emission
+    public func model(for id: String) -> Model? {
+        return models[id]?.model
+    }
+
+    /// `updated_at` of a row in the last applied emission
+    public func version(of id: String) -> String? {
+        return models[id]?.version ?? nil
+    }
+    
+    /// Forget the previous emission; every row of the next one is built again
+    public func reset() {
+        models = [:]
+        committedIds = []
+    }
+}
@@ -137,7 +137,7 @@ public class ZyraMultiTableForm: ObservableObject {
     @discardableResult
     public func validateField(_ field: String) -> Bool {
         guard let table = fieldToTable[field],
-              let column = table.columns.first(where: { $0.name == field }) else {
+              let column = table.column(named: field) else {
             return true
         }
         
@@ -196,11 +196,12 @@ public class ZyraMultiTableForm: ObservableObject {
                 database: database
             )
             
-            let tableConfig = config.table.toTableFieldConfig()
+            let tableConfig = config.table.fieldConfig
             
             let recordId = try await service.createRecord(
                 fields: data,
                 encryptedFields: tableConfig.encryptedFields,
+                blindIndexedFields: tableConfig.blindIndexedFields,
                 autoGenerateId: true,
                 autoTimestamp: true
             )
@@ -267,7 +268,8 @@ public class ZyraMultiTableForm: ObservableObject {
         
         let publicId = try await publicService.createRecord(
             fields: publicData,
-            encryptedFields: publicConfig.table.toTableFieldConfig().encryptedFields,
+            encryptedFields: publicConfig.table.fieldConfig.encryptedFields,
+            blindIndexedFields: publicConfig.table.fieldConfig.blindIndexedFields,
             autoGenerateId: true,
             autoTimestamp: true
         )
@@ -301,7 +303,8 @@ public class ZyraMultiTableForm: ObservableObject {
         
         let privateId = try await privateService.createRecord(
             fields: privateData,
-            encryptedFields: privateConfig.table.toTableFieldConfig().encryptedFields,
+            encryptedFields: privateConfig.table.fieldConfig.encryptedFields,
+            blindIndexedFields: privateConfig.table.fieldConfig.blindIndexedFields,
             autoGenerateId: true,
             autoTimestamp: true
         )
@@ -358,12 +361,7 @@ public class ZyraMultiTableForm: ObservableObject {
             )
             
             // Reload to get the full record with generated fields
-            try await service.loadRecords(
-                whereClause: "\(config.table.primaryKey) = ?",
-                parameters: [recordId]
-            )
-            
-            if let createdRecord = service.records.first {
+            if let createdRecord = try await service.getOne(id: recordId) {
                 results[config.table.name] = createdRecord
             }
             
@@ -423,7 +421,7 @@ public class ZyraMultiTableForm: ObservableObject {
             // Populate form fields from record
             for field in config.fields {
                 // Get value from record using schema-aware type conversion
-                if let column = config.table.columns.first(where: { $0.name == field }) {
+                if let column = config.table.column(named: field) {
                     // Handle different types appropriately
                     switch column.swiftType {
                     case .integer, .bigInt:
@@ -534,12 +532,7 @@ public class ZyraMultiTableForm: ObservableObject {
             )
             
             // Load existing record
-            try await service.loadRecords(
-                whereClause: "\(config.table.primaryKey) = ?",
-                parameters: [recordId]
-            )
-            
-            guard let existingRecord = service.records.first else {
+            guard let existingRecord = try await service.getOne(id: recordId) else {
                 throw NSError(domain: "ZyraMultiTableForm", code: 404, userInfo: [NSLocalizedDescriptionKey: "Record not found: \(config.table.name):\(recordId)"])
             }
             
@@ -0,0 +1,225 @@
+//
+//  ZyraPager.swift
+//  ZyraForm
+//
+//  Keyset-paginated, windowed watches for large tables
+//
+
+import Foundation
+import PowerSync
+import Combine
+
+// MARK: - Page Cursor
+
+/// Position of a row in a keyset-paged list: its sort value and primary key
+public struct ZyraPageCursor: Equatable {
+    /// Value of the sort column (nil when the row has none)
+    public let sortValue: Any?
+    public let id: String
+
+    init?(row: ZyraRow, sortColumn: String, primaryKey: String) {
+        guard let id = row.value(primaryKey).stringValue else { return nil }
+        self.id = id
+        self.sortValue = row[sortColumn]
+    }
+
+    public static func == (lhs: ZyraPageCursor, rhs: ZyraPageCursor) -> Bool {
+        return lhs.id == rhs.id && ZyraValue(lhs.sortValue) == ZyraValue(rhs.sortValue)
+    }
+}
+
+// MARK: - Pager
+
+/// A list over a large query that only decodes and watches the visible page
+/// Pages are keyset windows on the sort column (the query's first ordering, else the table's `defaultOrderBy`)
+/// plus the primary key, so moving through the list never uses OFFSET and every window costs the same
+/// regardless of table size. Only the current window is watched (one extra row tells whether a next page
+/// exists); the next page is prefetched once the current one is published, so `nextPage()` shows it at once.
+///
+/// The sort column should be NOT NULL (rows with a NULL sort value fall outside every keyset window)
+///
+/// Example:
+/// ```
+/// let pager = service.pager(query: todos.query().where("user_id", equals: userId), pageSize: 50)
+/// try await pager.start()
+/// ...
+/// try await pager.nextPage()
+/// ```
+@MainActor
+public final class ZyraPager: ObservableObject {
+    /// Rows of the current page, kept up to date while the page is watched
+    @Published public private(set) var rows: [ZyraRow] = []
+
+    /// Whether at least one row follows the current page
+    @Published public private(set) var hasNextPage = false
+
+    /// Whether the current page starts after the first row of the list
+    @Published public private(set) var hasPreviousPage = false
+
+    public let pageSize: Int
+    public let query: ZyraQuery
+
+    /// Position of the first row of the current page (nil = start of the list)
+    public private(set) var pageStart: ZyraPageCursor?
+
+    private let service: ZyraSync
+    private var nextStart: ZyraPageCursor?
+    private var subscription: ZyraWatchSubscription?
+    private var readiness: ZyraWatchReadiness?
+    private var prefetched: (start: ZyraPageCursor, rows: [ZyraRow])?
+    private var prefetchTask: Task<Void, Never>?
+
+    init(service: ZyraSync, query: ZyraQuery, pageSize: Int) {
+        self.service = service
+        self.query = query
+        self.pageSize = max(1, pageSize)
+    }
+
+    deinit {
+        subscription?.cancel()
+        prefetchTask?.cancel()
+    }
+
+    /// Dictionary view of `rows`
+    public var records: [[String: Any]] {
+        return rows.map { $0.dictionary }
+    }
+
+    /// `rows` as SchemaRecords of the query's table
+    public var schemaRecords: [SchemaRecord] {
+        return rows.map { SchemaRecord(schema: query.table, row: $0) }
+    }
+
+    // MARK: - Navigation
+
+    /// Watch the first page
+    /// - Parameter timeout: Maximum seconds to wait for the page's first snapshot (nil = no limit)
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func start(timeout: TimeInterval? = nil) async throws {
+        try await watch(from: nil, timeout: timeout)
+    }
+
+    /// Move to the page after the current one; does nothing on the last page
+    /// A prefetched next page is shown immediately, before its watch delivers
+    public func nextPage(timeout: TimeInterval? = nil) async throws {
+        guard let next = nextStart else { return }
+
+        if let prefetched = prefetched, prefetched.start == next {
+            rows = prefetched.rows
+        }
+        try await watch(from: next, timeout: timeout)
+    }
+
+    /// Move to the page before the current one; does nothing on the first page
+    public func previousPage(timeout: TimeInterval? = nil) async throws {
+        guard let start = pageStart else { return }
+
+        let sortKey = try query.sortKey()
+        let backwards = query.window(
+            sortColumn: sortKey.column,
+            ascending: sortKey.ascending,
+            from: start,
+            forward: false,
+            inclusive: false,
+            limit: pageSize
+        )
+        let earlier = try await service.fetchRows(query: backwards)
+
+        // A short read means the previous page is the head of the list
+        let previousStart = earlier.count < pageSize
+            ? nil
+            : earlier.last.flatMap { ZyraPageCursor(row: $0, sortColumn: sortKey.column, primaryKey: query.table.primaryKey) }
+        if previousStart != nil {
+            rows = earlier.reversed()
+        }
+        try await watch(from: previousStart, timeout: timeout)
+    }
+
+    /// Stop watching the current page; `rows` keeps its last value
+    public func stop() {
+        subscription?.cancel()
+        subscription = nil
+        readiness?.supersede()
+        readiness = nil
+        prefetchTask?.cancel()
+        prefetchTask = nil
+    }
+
+    // MARK: - Windows
+
+    /// Replace the watched window with the page starting at `start`
+    private func watch(from start: ZyraPageCursor?, timeout: TimeInterval?) async throws {
+        let sortKey = try query.sortKey()
+        // One row past the page tells whether a next page exists and where it starts
+        let window = query.window(
+            sortColumn: sortKey.column,
+            ascending: sortKey.ascending,
+            from: start,
+            forward: true,
+            inclusive: true,
+            limit: pageSize + 1
+        )
+        let compiled = try window.compile()
+
+        let readiness = ZyraWatchReadiness()
+        self.readiness?.supersede()
+        self.readiness = readiness
+        pageStart = start
+        hasPreviousPage = start != nil
+
+        let previous = subscription
+        let parameters = try service.resolvingBlindValues(window.parameters)
+        subscription = service.subscribe(sql: compiled.sql, parameters: parameters, plan: compiled.plan) { [weak self] event in
+            guard let self = self, self.readiness === readiness else { return }
+
+            switch event {
+            case .snapshot(let results, _):
+                self.publish(results, sortColumn: sortKey.column)
+                readiness.succeed()
+            case .failure(let error):
+                readiness.fail(error)
+                self.subscription = nil
+                ZyraFormLogger.error("❌ Page watch error for \(self.query.table.name): \(error.localizedDescription)")
+            }
+        }
+        previous?.cancel()
+
+        let elapsed = try await readiness.wait(timeout: timeout)
+        ZyraFormLogger.debug("📄 Page of \(query.table.name) ready in \(String(format: "%.1f", elapsed * 1000)) ms")
+    }
+
+    private func publish(_ results: [ZyraRow], sortColumn: String) {
+        // Page cursors keep the stored values; only the shown rows carry pending write-behind values
+        rows = service.overlayingPendingWrites(Array(results.prefix(pageSize)))
+
+        let primaryKey = query.table.primaryKey
+        nextStart = results.count > pageSize
+            ? ZyraPageCursor(row: results[pageSize], sortColumn: sortColumn, primaryKey: primaryKey)
+            : nil
+        hasNextPage = nextStart != nil
+
+        if let next = nextStart {
+            prefetch(from: next)
+        }
+    }
+
+    /// Read the page starting at `start` once, so moving to it does not wait for a watch
+    private func prefetch(from start: ZyraPageCursor) {
+        guard prefetched?.start != start, let sortKey = try? query.sortKey() else { return }
+        prefetched = nil
+        prefetchTask?.cancel()
+
+        let page = query.window(
+            sortColumn: sortKey.column,
+            ascending: sortKey.ascending,
+            from: start,
+            forward: true,
+            inclusive: true,
+            limit: pageSize
+        )
+        prefetchTask = Task { [weak self] in
+            guard let self = self, let rows = try? await self.service.fetchRows(query: page), !Task.isCancelled else { return }
+            self.prefetched = (start, rows)
+        }
+    }
+}
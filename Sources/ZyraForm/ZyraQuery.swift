@@ -0,0 +1,445 @@
+//
+//  ZyraQuery.swift
+//  ZyraForm
+//
+//  Typed, schema-checked query builder with compiled-SQL caching
+//
+
+import Foundation
+
+// MARK: - Query
+
+/// Comparison operators usable in a `ZyraQuery` filter
+public enum ZyraComparison: String, Hashable {
+    case equal = "="
+    case notEqual = "!="
+    case lessThan = "<"
+    case lessThanOrEqual = "<="
+    case greaterThan = ">"
+    case greaterThanOrEqual = ">="
+    case like = "LIKE"
+}
+
+/// A SELECT against one `ZyraTable`, built fluently and checked against its schema
+/// Compiles to parameterized SQL plus a decode plan once per query shape (columns, operators,
+/// IN-list sizes, ordering, projection, whether limit/offset are set); the compiled form is cached,
+/// so repeated screens only bind new values
+///
+/// Example:
+/// ```
+/// let query = todos.query()
+///     .where("user_id", .equal, userId)
+///     .where("priority", .greaterThanOrEqual, 2)
+///     .whereIn("status", ["open", "blocked"])
+///     .orderBy("created_at", ascending: false)
+///     .limit(50)
+/// try await service.loadRecords(query: query)
+/// ```
+public struct ZyraQuery {
+    public let table: ZyraTable
+
+    enum Predicate: Hashable {
+        case compare(column: String, comparison: ZyraComparison)
+        case isIn(column: String, count: Int)
+        case isNull(column: String, negated: Bool)
+        /// Rows at or after a (sort value, primary key) position in the given direction
+        case keyset(column: String, primaryKey: String, ascending: Bool, inclusive: Bool)
+    }
+
+    struct Ordering: Hashable {
+        let column: String
+        let ascending: Bool
+    }
+
+    private(set) var predicates: [Predicate] = []
+    private(set) var values: [Any] = []
+    private(set) var orderings: [Ordering] = []
+    private(set) var limitCount: Int?
+    private(set) var offsetCount: Int?
+    /// Selected columns, nil = every schema column
+    public private(set) var projection: [String]?
+
+    public init(table: ZyraTable) {
+        self.table = table
+    }
+
+    // MARK: - Filters
+
+    /// Keep rows where `column` compares to `value`
+    /// On a blind-indexed encrypted column, `.equal` and `.notEqual` compare its blind-index tokens
+    public func `where`(_ column: String, _ comparison: ZyraComparison, _ value: Any) -> ZyraQuery {
+        var query = self
+        query.predicates.append(.compare(column: column, comparison: comparison))
+        query.values.append(blindable(value, column: column))
+        return query
+    }
+
+    /// Keep rows where `column` equals `value`
+    public func `where`(_ column: String, equals value: Any) -> ZyraQuery {
+        return self.where(column, .equal, value)
+    }
+
+    /// Keep rows where `column` is one of `values`; an empty list matches nothing
+    public func whereIn(_ column: String, _ values: [Any]) -> ZyraQuery {
+        var query = self
+        query.predicates.append(.isIn(column: column, count: values.count))
+        query.values.append(contentsOf: values.map { blindable($0, column: column) })
+        return query
+    }
+
+    /// Keep rows where `column` is NULL
+    public func whereNull(_ column: String) -> ZyraQuery {
+        var query = self
+        query.predicates.append(.isNull(column: column, negated: false))
+        return query
+    }
+
+    /// Keep rows where `column` is not NULL
+    public func whereNotNull(_ column: String) -> ZyraQuery {
+        var query = self
+        query.predicates.append(.isNull(column: column, negated: true))
+        return query
+    }
+
+    // MARK: - Ordering, Paging, Projection
+
+    /// Order by `column`; later calls break ties of earlier ones
+    /// Without any ordering the table's `defaultOrderBy` is used
+    public func orderBy(_ column: String, ascending: Bool = true) -> ZyraQuery {
+        var query = self
+        query.orderings.append(Ordering(column: column, ascending: ascending))
+        return query
+    }
+
+    /// Return at most `count` rows
+    public func limit(_ count: Int) -> ZyraQuery {
+        var query = self
+        query.limitCount = max(0, count)
+        return query
+    }
+
+    /// Skip the first `count` rows
+    public func offset(_ count: Int) -> ZyraQuery {
+        var query = self
+        query.offsetCount = max(0, count)
+        return query
+    }
+
+    /// Select only `columns` (in this order)
+    public func select(_ columns: [String]) -> ZyraQuery {
+        var query = self
+        query.projection = columns
+        return query
+    }
+
+    // MARK: - Compiling
+
+    /// Values bound to the compiled SQL's placeholders, in order
+    /// Filters on blind-indexed columns hold their plaintext here; `ZyraSync` binds the token instead
+    public var parameters: [Any] {
+        var parameters = values
+        if let limitCount = limitCount {
+            parameters.append(limitCount)
+        } else if offsetCount != nil {
+            // SQLite needs a LIMIT before OFFSET; -1 means no limit
+            parameters.append(-1)
+        }
+        if let offsetCount = offsetCount {
+            parameters.append(offsetCount)
+        }
+        return parameters
+    }
+
+    /// The cache key: everything that affects the SQL text and the decode plan, but no values
+    var shape: ZyraQueryShape {
+        return ZyraQueryShape(
+            predicates: predicates,
+            orderings: orderings,
+            hasLimit: limitCount != nil || offsetCount != nil,
+            hasOffset: offsetCount != nil,
+            projection: projection
+        )
+    }
+
+    /// Compiled SQL and decode plan for this query's shape, from the table's cache when it was compiled before
+    /// - Throws: `ZyraQueryError` when a column is not in the schema or a predicate targets an encrypted column
+    public func compile() throws -> ZyraCompiledQuery {
+        return try table.queryCache.compiled(for: shape) {
+            try ZyraQuery.build(shape: $0, table: table)
+        }
+    }
+
+    private static func build(shape: ZyraQueryShape, table: ZyraTable) throws -> ZyraCompiledQuery {
+        let config = table.fieldConfig
+
+        let fields = shape.projection ?? config.allFields
+        let selectList = try fields.map { try column($0, in: table) }.joined(separator: ", ")
+        var sql = "SELECT \(selectList) FROM \"\(table.name)\""
+        sql += try whereClause(shape.predicates, table: table)
+
+        if shape.orderings.isEmpty {
+            sql += " ORDER BY \(table.defaultOrderBy)"
+        } else {
+            let terms = try shape.orderings.map { ordering -> String in
+                let quoted = try plainColumn(ordering.column, in: table)
+                return "\(quoted) \(ordering.ascending ? "ASC" : "DESC")"
+            }
+            sql += " ORDER BY " + terms.joined(separator: ", ")
+        }
+
+        if shape.hasLimit {
+            sql += " LIMIT ?"
+        }
+        if shape.hasOffset {
+            sql += " OFFSET ?"
+        }
+
+        return ZyraCompiledQuery(
+            sql: sql,
+            fields: fields,
+            plan: ZyraDecodePlan(config: config, fields: fields, fieldsMatchSelectOrder: true)
+        )
+    }
+
+    /// Quoted name of a schema column
+    static func column(_ name: String, in table: ZyraTable) throws -> String {
+        guard table.column(named: name) != nil else {
+            throw ZyraQueryError.unknownColumn(name, table: table.name)
+        }
+        return "\"\(name)\""
+    }
+
+    /// Quoted name of a schema column whose stored values SQL can compare
+    /// Encrypted values are randomized ciphertext: no comparison, range, pattern or order on them can match
+    static func plainColumn(_ name: String, in table: ZyraTable) throws -> String {
+        let quoted = try column(name, in: table)
+        guard !table.fieldConfig.isEncrypted(name) else {
+            throw ZyraQueryError.encryptedColumn(name, table: table.name)
+        }
+        return quoted
+    }
+
+    /// ` WHERE ...` for the predicates, or an empty string when there are none
+    static func whereClause(_ predicates: [Predicate], table: ZyraTable) throws -> String {
+        guard !predicates.isEmpty else { return "" }
+
+        let clauses = try predicates.map { predicate -> String in
+            switch predicate {
+            case .compare(let name, let comparison) where isBlindLookup(name, comparison, in: table):
+                return "\"\(ZyraTable.blindIndexColumn(for: name))\" \(comparison.rawValue) ?"
+            case .isIn(let name, let count) where table.fieldConfig.isBlindIndexed(name):
+                guard count > 0 else { return "0" }
+                return "\"\(ZyraTable.blindIndexColumn(for: name))\" IN (\(Array(repeating: "?", count: count).joined(separator: ", ")))"
+            case .compare(let name, let comparison):
+                let quoted = try plainColumn(name, in: table)
+                return "\(quoted) \(comparison.rawValue) ?"
+            case .isIn(let name, let count):
+                let quoted = try plainColumn(name, in: table)
+                guard count > 0 else { return "0" }
+                return "\(quoted) IN (\(Array(repeating: "?", count: count).joined(separator: ", ")))"
+            case .isNull(let name, let negated):
+                let quoted = try column(name, in: table)
+                return "\(quoted) IS \(negated ? "NOT " : "")NULL"
+            case .keyset(let name, let primaryKey, let ascending, let inclusive):
+                let quoted = try plainColumn(name, in: table)
+                let key = try plainColumn(primaryKey, in: table)
+                let beyond = ascending ? ">" : "<"
+                return "(\(quoted) \(beyond) ? OR (\(quoted) = ? AND \(key) \(beyond)\(inclusive ? "=" : "") ?))"
+            }
+        }
+        return " WHERE " + clauses.joined(separator: " AND ")
+    }
+
+    /// Whether a comparison on `column` is answered by its blind-index tokens
+    private static func isBlindLookup(_ column: String, _ comparison: ZyraComparison, in table: ZyraTable) -> Bool {
+        return (comparison == .equal || comparison == .notEqual) && table.fieldConfig.isBlindIndexed(column)
+    }
+
+    /// A filter value, marked for tokenizing when `column` is blind-indexed
+    /// The token depends on the reading user's key, so `ZyraSync` swaps it in when the query runs
+    private func blindable(_ value: Any, column: String) -> Any {
+        let bound = ZyraQuery.bindable(value)
+        guard table.fieldConfig.isBlindIndexed(column), !(bound is NSNull) else { return bound }
+        return ZyraBlindValue(field: column, plaintext: ZyraSync.plaintext(of: bound))
+    }
+
+    /// Values as the library stores them: booleans as "true"/"false", dates as ISO 8601 text
+    private static func bindable(_ value: Any) -> Any {
+        if let flag = value as? Bool, type(of: value) == Bool.self {
+            return flag ? "true" : "false"
+        }
+        if let date = value as? Date {
+            return ZyraTimestamp.string(from: date)
+        }
+        return value
+    }
+}
+
+// MARK: - Keyset Paging
+
+extension ZyraQuery {
+    /// The column a keyset pager sorts on: the query's first ordering, else the first term of `defaultOrderBy`
+    func sortKey() throws -> (column: String, ascending: Bool) {
+        if let first = orderings.first {
+            return (first.column, first.ascending)
+        }
+
+        guard let term = ZyraTable.sortTerm(of: table.defaultOrderBy) else {
+            return (table.primaryKey, true)
+        }
+        guard table.column(named: term.column) != nil else {
+            throw ZyraQueryError.unknownColumn(term.column, table: table.name)
+        }
+        return term
+    }
+
+    /// A page window: this query's filters, ordered by the sort column then the primary key,
+    /// starting at `cursor` (or the beginning) and reading at most `limit` rows
+    /// - Parameters:
+    ///   - forward: false reads backwards from `cursor`, in reverse order
+    ///   - inclusive: Whether the row at `cursor` itself is part of the window
+    func window(
+        sortColumn: String,
+        ascending: Bool,
+        from cursor: ZyraPageCursor?,
+        forward: Bool,
+        inclusive: Bool,
+        limit: Int
+    ) -> ZyraQuery {
+        let primaryKey = table.primaryKey
+        let direction = forward ? ascending : !ascending
+
+        var query = self
+        if let cursor = cursor {
+            query.predicates.append(.keyset(column: sortColumn, primaryKey: primaryKey, ascending: direction, inclusive: inclusive))
+            // The cursor holds the decoded value (e.g. a Bool); compare against the stored form
+            let sortValue = cursor.sortValue.map { ZyraQuery.bindable($0) } ?? NSNull()
+            query.values.append(contentsOf: [sortValue, sortValue, cursor.id])
+        }
+        query.orderings = [
+            Ordering(column: sortColumn, ascending: direction),
+            Ordering(column: primaryKey, ascending: direction)
+        ]
+        if let projection = projection {
+            // Every page row must carry its own position
+            var extended = projection
+            for column in [sortColumn, primaryKey] where !extended.contains(column) {
+                extended.append(column)
+            }
+            query.projection = extended
+        }
+        query.limitCount = limit
+        query.offsetCount = nil
+        return query
+    }
+}
+
+extension ZyraTable {
+    /// Start a typed query against this table
+    public func query() -> ZyraQuery {
+        return ZyraQuery(table: self)
+    }
+}
+
+// MARK: - Compiled Queries
+
+/// Parameterized SQL and decode plan for one query shape
+public struct ZyraCompiledQuery {
+    public let sql: String
+    /// Selected columns, in SELECT order
+    public let fields: [String]
+    public let plan: ZyraDecodePlan
+}
+
+/// Everything that determines a compiled query
+struct ZyraQueryShape: Hashable {
+    let predicates: [ZyraQuery.Predicate]
+    let orderings: [ZyraQuery.Ordering]
+    let hasLimit: Bool
+    let hasOffset: Bool
+    let projection: [String]?
+}
+
+/// Compiled queries of one table by shape, shared by every copy of the table and every service using it
+/// Thread-safe. Shapes include IN-list sizes, so at most `capacity` queries and `capacity` aggregates
+/// are kept; when either is full it starts over
+public final class ZyraQueryCache: @unchecked Sendable {
+    /// Most compiled queries (and, separately, aggregates) kept at once
+    public let capacity: Int
+
+    private let lock = NSLock()
+    private var compiled: [ZyraQueryShape: ZyraCompiledQuery] = [:]
+    private var aggregates: [ZyraAggregateShape: ZyraCompiledAggregate] = [:]
+
+    public init(capacity: Int = 256) {
+        self.capacity = max(1, capacity)
+    }
+
+    /// Number of compiled shapes
+    public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return compiled.count + aggregates.count
+    }
+
+    /// Drop every compiled query (e.g. after a schema change)
+    public func removeAll() {
+        lock.lock()
+        compiled.removeAll()
+        aggregates.removeAll()
+        lock.unlock()
+    }
+
+    func compiled(for shape: ZyraQueryShape, build: (ZyraQueryShape) throws -> ZyraCompiledQuery) throws -> ZyraCompiledQuery {
+        lock.lock()
+        if let cached = compiled[shape] {
+            lock.unlock()
+            return cached
+        }
+        lock.unlock()
+
+        let built = try build(shape)
+
+        lock.lock()
+        if compiled.count >= capacity {
+            compiled.removeAll(keepingCapacity: true)
+        }
+        compiled[shape] = built
+        lock.unlock()
+        return built
+    }
+
+    func compiled(for shape: ZyraAggregateShape, build: (ZyraAggregateShape) throws -> ZyraCompiledAggregate) throws -> ZyraCompiledAggregate {
+        lock.lock()
+        if let cached = aggregates[shape] {
+            lock.unlock()
+            return cached
+        }
+        lock.unlock()
+
+        let built = try build(shape)
+
+        lock.lock()
+        if aggregates.count >= capacity {
+            aggregates.removeAll(keepingCapacity: true)
+        }
+        aggregates[shape] = built
+        lock.unlock()
+        return built
+    }
+}
+
+// MARK: - Query Errors
+public enum ZyraQueryError: LocalizedError {
+    case unknownColumn(String, table: String)
+    case encryptedColumn(String, table: String)
+
+    public var errorDescription: String? {
+        switch self {
+        case .unknownColumn(let column, let table):
+            return "Column '\(column)' does not exist in table '\(table)'"
+        case .encryptedColumn(let column, let table):
+            return "Column '\(column)' of table '\(table)' is encrypted and cannot be filtered, ordered or aggregated in SQL (mark it blindIndexed() for equality filters)"
+        }
+    }
+}
@@ -0,0 +1,50 @@
+//
+//  ZyraRecordsView.swift
+//  ZyraForm
+//
+//  Dictionary view of a service's rows, built only when it is read
+//
+
+import Foundation
+import Combine
+
+/// `[String: Any]` view of `ZyraSync.rows`, kept for compatibility
+/// Only the rows are held between emissions: the dictionaries are built on the first read after the rows
+/// change and dropped on the next change. `$records` publishes each new set of rows as dictionaries,
+/// built only for its subscribers. Setting the view replaces the rows
+@propertyWrapper
+public final class ZyraRecordsView {
+    private let subject = CurrentValueSubject<[ZyraRow], Never>([])
+    private var cache: [[String: Any]]?
+
+    /// Replaces the owner's rows with records set directly
+    var assign: (([[String: Any]]) -> Void)?
+
+    public init() {}
+
+    public var wrappedValue: [[String: Any]] {
+        get {
+            if let cache = cache {
+                return cache
+            }
+            let built = subject.value.map { $0.dictionary }
+            cache = built
+            return built
+        }
+        set {
+            assign?(newValue)
+        }
+    }
+
+    public var projectedValue: AnyPublisher<[[String: Any]], Never> {
+        return subject
+            .map { rows in rows.map { $0.dictionary } }
+            .eraseToAnyPublisher()
+    }
+
+    /// The owner's rows changed
+    func update(_ rows: [ZyraRow]) {
+        cache = nil
+        subject.send(rows)
+    }
+}
@@ -0,0 +1,156 @@
+//
+//  ZyraSearch.swift
+//  ZyraForm
+//
+//  Local FTS5 full-text search over searchable columns
+//
+
+import Foundation
+import PowerSync
+
+// MARK: - Search Index
+
+extension ZyraTable {
+    /// Name of the table's FTS5 index
+    public var searchIndexName: String {
+        return "\(name)_fts"
+    }
+
+    /// PowerSync's storage table behind the table's view; both local writes and sync applies land here
+    var storageTableName: String {
+        return "ps_data__\(name)"
+    }
+
+    /// Statements creating the FTS5 index and the triggers that keep it in sync (empty without searchable columns)
+    /// Index rows are keyed by the record id (an unindexed `id` column), and values are read from the storage
+    /// row's JSON `data`, so every insert, update and delete (local or synced) is mirrored in the same transaction.
+    /// Sync applies replace storage rows, which removes the old row without firing the delete trigger and may
+    /// give the new one another rowid; the insert trigger therefore drops the id's index row before adding it
+    public func searchIndexStatements() -> [String] {
+        guard !searchableFields.isEmpty else { return [] }
+
+        let index = "\"\(searchIndexName)\""
+        let storage = "\"\(storageTableName)\""
+        let columns = searchIndexColumns
+        let values = { (row: String) in
+            self.searchableFields.map { "json_extract(\(row).data, '$.\($0)')" }.joined(separator: ", ")
+        }
+
+        return [
+            "CREATE VIRTUAL TABLE IF NOT EXISTS \(index) USING fts5(\"id\" UNINDEXED, \(columns), tokenize = 'unicode61 remove_diacritics 2')",
+            """
+            CREATE TRIGGER IF NOT EXISTS "\(searchIndexName)_insert" AFTER INSERT ON \(storage) BEGIN
+                DELETE FROM \(index) WHERE "id" = NEW.id;
+                INSERT INTO \(index)("id", \(columns)) VALUES (NEW.id, \(values("NEW")));
+            END
+            """,
+            """
+            CREATE TRIGGER IF NOT EXISTS "\(searchIndexName)_update" AFTER UPDATE ON \(storage) BEGIN
+                DELETE FROM \(index) WHERE "id" = OLD.id OR "id" = NEW.id;
+                INSERT INTO \(index)("id", \(columns)) VALUES (NEW.id, \(values("NEW")));
+            END
+            """,
+            """
+            CREATE TRIGGER IF NOT EXISTS "\(searchIndexName)_delete" AFTER DELETE ON \(storage) BEGIN
+                DELETE FROM \(index) WHERE "id" = OLD.id;
+            END
+            """
+        ]
+    }
+
+    /// Searchable columns of the index, quoted
+    private var searchIndexColumns: String {
+        return searchableFields.map { "\"\($0)\"" }.joined(separator: ", ")
+    }
+
+    /// Statements refilling the FTS5 index from the storage table
+    public func searchIndexRebuildStatements() -> [String] {
+        guard !searchableFields.isEmpty else { return [] }
+
+        let values = searchableFields.map { "json_extract(data, '$.\($0)')" }.joined(separator: ", ")
+        return [
+            "DELETE FROM \"\(searchIndexName)\"",
+            "INSERT INTO \"\(searchIndexName)\"(\"id\", \(searchIndexColumns)) SELECT id, \(values) FROM \"\(storageTableName)\""
+        ]
+    }
+
+    /// Ranked search: rows of the table's view whose searchable columns match, best match first
+    /// Parameters: the match expression, the filter values, then the limit
+    func searchSQL(fields: [String], predicates: [ZyraQuery.Predicate]) throws -> String {
+        let selectList = try fields.map { try ZyraQuery.column($0, in: self) }.joined(separator: ", ")
+        let index = "\"\(searchIndexName)\""
+
+        // Rank inside a subquery, so filters on the outer query cannot clash with the index's column names
+        var sql = "SELECT \(selectList) FROM ("
+        sql += "SELECT \"v\".*, \(index).rank AS \"_search_rank\" FROM \(index)"
+        sql += " JOIN \"\(name)\" AS \"v\" ON \"v\".\"\(primaryKey)\" = \(index).\"id\""
+        sql += " WHERE \(index) MATCH ?"
+        sql += ")"
+        sql += try ZyraQuery.whereClause(predicates, table: self)
+        sql += " ORDER BY \"_search_rank\" LIMIT ?"
+        return sql
+    }
+}
+
+// MARK: - Match Expressions
+
+public enum ZyraSearch {
+    /// FTS5 match expression for free text typed by a user
+    /// Each word becomes a quoted prefix term (`"word"*`), so FTS5 operators and punctuation in the
+    /// input are matched literally and results narrow while typing; nil when there is nothing to search
+    public static func matchExpression(for text: String) -> String? {
+        let terms = text
+            .split(whereSeparator: { $0.isWhitespace })
+            .map { "\"\($0.replacingOccurrences(of: "\"", with: "\"\""))\"*" }
+        return terms.isEmpty ? nil : terms.joined(separator: " ")
+    }
+}
+
+// MARK: - Installing
+
+extension ZyraSchema {
+    /// Create (or keep) the FTS5 index of every table with searchable columns, in one write transaction
+    /// Idempotent: run after opening the database and before syncing. An index created by this call
+    /// is filled from the rows already stored, later writes are mirrored by its triggers
+    public func installSearchIndexes(on database: PowerSync.PowerSyncDatabaseProtocol) async throws {
+        let searchable = tables.filter { !$0.searchableFields.isEmpty }
+        guard !searchable.isEmpty else { return }
+
+        // Index tables that already exist were filled when they were created
+        let existing = try await database.getAll(
+            sql: "SELECT name FROM sqlite_master WHERE type = 'table'",
+            parameters: [],
+            mapper: { cursor in
+                cursor.getStringOptional(index: 0) ?? ""
+            }
+        )
+        let existingIndexes = Set(existing)
+
+        try await database.writeTransaction { transaction in
+            for table in searchable {
+                for statement in table.searchIndexStatements() {
+                    try transaction.execute(sql: statement, parameters: [])
+                }
+                if !existingIndexes.contains(table.searchIndexName) {
+                    for statement in table.searchIndexRebuildStatements() {
+                        try transaction.execute(sql: statement, parameters: [])
+                    }
+                }
+            }
+        }
+
+        ZyraFormLogger.info("🔎 Search indexes ready for \(searchable.map { $0.name }.joined(separator: ", "))")
+    }
+
+    /// Refill every search index from the stored rows (e.g. after restoring a database without the triggers)
+    public func rebuildSearchIndexes(on database: PowerSync.PowerSyncDatabaseProtocol) async throws {
+        let searchable = tables.filter { !$0.searchableFields.isEmpty }
+        try await database.writeTransaction { transaction in
+            for table in searchable {
+                for statement in table.searchIndexRebuildStatements() {
+                    try transaction.execute(sql: statement, parameters: [])
+                }
+            }
+        }
+    }
+}
@@ -18,59 +18,157 @@ public class ZyraSync: ObservableObject {
     private let userId: String
     private let encryptionManager: SecureEncryptionManager
     private let tableName: String
+    private let primaryKey: String
+    
+    /// Decrypted values shared by every service reading this table
+    public let decryptCache: ZyraDecryptCache
+
+    /// SQL text of writes, shared by every service writing this table
+    public let writeStatements: ZyraWriteStatements
+
+    /// Order of the columns this service writes (schema-aware services set it from their schema)
+    public var columnOrder = ZyraColumnOrder()
+
+    /// Rows of the current watch, stored compactly (one shared column layout per result set)
+    @Published public private(set) var rows: [ZyraRow] = [] {
+        didSet {
+            _records.update(rows)
+        }
+    }
+    
+    /// Dictionary form of `rows`, kept for compatibility
+    /// Built on first read after `rows` changes rather than per emission; setting it replaces `rows`
+    @ZyraRecordsView public var records: [[String: Any]]
+    
+    /// Seconds from starting the current watch to its first published snapshot (nil until it arrives)
+    public private(set) var timeToFirstRow: TimeInterval?
+    
+    /// Executor that decrypts and converts watch results off the main actor
+    public var decodeExecutor: ZyraDecodeExecutor = .shared
+    
+    /// How bursts of watch emissions are coalesced; applies to the next `loadRecords` call
+    public var watchCoalescing: ZyraWatchCoalescing = .default
+    
+    /// Snapshots the current watch dropped because a newer one arrived while it was busy
+    public var droppedEmissions: Int {
+        return watchSubscription?.statistics.dropped ?? 0
+    }
+    
+    /// Hold `updateRecord` calls in memory and write them coalesced per record (nil = write each update at once)
+    /// Turning it off flushes what is pending
+    public var writeBehind: ZyraWriteBehind? {
+        didSet {
+            configureWriteBehind()
+        }
+    }
+
+    /// Records with write-behind updates not yet written
+    public var pendingWriteCount: Int {
+        return writeBehindQueue?.count ?? 0
+    }
+
+    private var writeBehindQueue: ZyraWriteBehindQueue?
 
-    @Published public var records: [[String: Any]] = []
+    private var changeContinuations: [UUID: AsyncStream<ZyraChangeSet>.Continuation] = [:]
     
-    private var watchTask: Task<Void, Never>?
+    private var watchSubscription: ZyraWatchSubscription?
+    private var watchReadiness: ZyraWatchReadiness?
     private var currentWatchQuery: String?
     private var currentWatchParams: [Any] = []
     private var currentWatchFields: [String] = []
     private var currentWatchConfig: (encryptedFields: [String], integerFields: [String], booleanFields: [String]) = ([], [], [])
     
     /// Initialize with table name, user ID, database, and optional encryption manager
-    public init(tableName: String, userId: String, database: PowerSync.PowerSyncDatabaseProtocol, encryptionManager: SecureEncryptionManager? = nil) {
+    /// - Parameter primaryKey: Column used to key rows in change sets (defaults to "id")
+    public init(tableName: String, userId: String, database: PowerSync.PowerSyncDatabaseProtocol, encryptionManager: SecureEncryptionManager? = nil, primaryKey: String = "id") {
         self.tableName = tableName
+        self.primaryKey = primaryKey
+        self.decryptCache = ZyraDecryptCache.shared(for: tableName)
+        self.writeStatements = ZyraWriteStatements.shared(for: tableName)
         self.userId = userId
         self.powerSync = database
         // Note: SecureEncryptionManager needs to be moved to package or made available
         self.encryptionManager = encryptionManager ?? SecureEncryptionManager.shared
+        _records.assign = { [weak self] records in
+            self?.replaceRows(with: records)
+        }
     }
     
     deinit {
-        watchTask?.cancel()
+        watchSubscription?.cancel()
+        for continuation in changeContinuations.values {
+            continuation.finish()
+        }
+        
+        // Pending write-behind updates outlive the service: a successor with the same settings writes them
+        if let queue = writeBehindQueue {
+            let tableName = tableName
+            let userId = userId
+            let database = powerSync
+            let encryptionManager = encryptionManager
+            let primaryKey = primaryKey
+            let columnOrder = columnOrder
+            Task { @MainActor in
+                guard !queue.isEmpty else { return }
+                let successor = ZyraSync(
+                    tableName: tableName,
+                    userId: userId,
+                    database: database,
+                    encryptionManager: encryptionManager,
+                    primaryKey: primaryKey
+                )
+                successor.columnOrder = columnOrder
+                queue.write = { updates in
+                    try await successor.writeUpdates(updates)
+                }
+                
+                let count = queue.count
+                do {
+                    try await queue.flush()
+                } catch {
+                    ZyraFormLogger.error("❌ Write-behind updates of \(count) \(tableName) records were not written after the service was released: \(error.localizedDescription)")
+                }
+            }
+        }
+    }
+    
+    // MARK: - Rows and Records
+    
+    /// Replace `rows` with records set directly
+    private func replaceRows(with records: [[String: Any]]) {
+        let layout = rows.first?.layout ?? ZyraRowLayout(names: records.first.map { Array($0.keys).sorted() } ?? [])
+        rows = records.map { ZyraRow(layout: layout, dictionary: $0) }
     }
     
     // MARK: - Watch Control
     
     /// Check if watching is currently active
     public var isWatching: Bool {
-        return watchTask != nil && !watchTask!.isCancelled
+        return watchSubscription != nil
     }
     
     /// Stop watching for updates programmatically
     /// Call this when a view/page is no longer active to free up memory and network resources
     /// Use `resumeWatching()` to restart watching with the last query configuration
     public func stopWatching() {
-        guard let task = watchTask else { return }
-        task.cancel()
-        watchTask = nil
+        guard let subscription = watchSubscription else { return }
+        subscription.cancel()
+        watchSubscription = nil
+        watchReadiness?.supersede()
+        watchReadiness = nil
         ZyraFormLogger.debug("⏹️ Watch stopped for \(tableName)")
     }
     
     /// Resume watching with the last query configuration
     /// This will restart watching using the last query that was executed via `loadRecords()` or `loadRecordsWithRawSQL()`
     /// If no previous query exists, this method does nothing
-    public func resumeWatching() async throws {
+    /// - Parameter timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
+    public func resumeWatching(timeout: TimeInterval? = nil) async throws {
         guard let query = currentWatchQuery, !currentWatchFields.isEmpty else {
             ZyraFormLogger.warning("⚠️ Cannot resume watching: no previous query configuration found")
             return
         }
         
-        // Cancel existing watch if any
-        if watchTask != nil {
-            watchTask?.cancel()
-        }
-        
         // Restart watch with stored configuration
         // Both loadRecords() and loadRecordsWithRawSQL() store the full SQL in currentWatchQuery
         try await loadRecordsWithRawSQL(
@@ -79,9 +177,121 @@ public class ZyraSync: ObservableObject {
             fieldsToRead: currentWatchFields,
             encryptedFields: currentWatchConfig.encryptedFields,
             integerFields: currentWatchConfig.integerFields,
-            booleanFields: currentWatchConfig.booleanFields
+            booleanFields: currentWatchConfig.booleanFields,
+            timeout: timeout
         )
     }
+    
+    /// Wait until the current watch has decoded and published its first snapshot
+    /// Returns immediately when it already has
+    /// - Parameter timeout: Maximum seconds to wait (nil = no limit)
+    /// - Returns: Time-to-first-row in seconds
+    /// - Throws: `ZyraSyncError.firstSnapshotTimeout` on timeout, or the watch's error if it failed first
+    @discardableResult
+    public func waitForFirstSnapshot(timeout: TimeInterval? = nil) async throws -> TimeInterval {
+        guard let readiness = watchReadiness else {
+            throw ZyraSyncError.watchNotStarted
+        }
+        return try await readiness.wait(timeout: timeout)
+    }
+
+    // MARK: - Write-Behind
+
+    /// Write every pending write-behind update now, in one write transaction
+    /// Call before leaving a form or when the written row must be in the database (e.g. before syncing)
+    public func flushPendingWrites() async throws {
+        try await writeBehindQueue?.flush()
+    }
+
+    private func configureWriteBehind() {
+        if let settings = writeBehind {
+            if let queue = writeBehindQueue {
+                queue.settings = settings
+            } else {
+                let table = tableName
+                writeBehindQueue = ZyraWriteBehindQueue(settings: settings, table: table) { [weak self] updates in
+                    // Failing keeps the updates pending; deinit hands them to a successor that writes them
+                    guard let self = self else {
+                        throw ZyraSyncError.serviceReleased(table)
+                    }
+                    try await self.writeUpdates(updates)
+                }
+            }
+            return
+        }
+
+        guard let queue = writeBehindQueue else { return }
+        writeBehindQueue = nil
+        guard !queue.isEmpty else { return }
+        Task {
+            do {
+                try await queue.flush()
+            } catch {
+                ZyraFormLogger.error("❌ Write-behind flush failed for \(tableName): \(error.localizedDescription)")
+            }
+        }
+    }
+
+    /// `row` with the pending write-behind values of its record
+    /// Only columns the row holds are replaced; values are plaintext, like decoded rows
+    private func overlayingPendingWrites(_ row: ZyraRow) -> ZyraRow {
+        guard let queue = writeBehindQueue,
+              let id = row.string(primaryKey),
+              let fields = queue.pendingFields(for: id) else {
+            return row
+        }
+
+        var overlaid = row
+        for (name, value) in fields where row.layout.ordinal(of: name) != nil {
+            overlaid.set(name, to: value)
+        }
+        return overlaid
+    }
+
+    func overlayingPendingWrites(_ rows: [ZyraRow]) -> [ZyraRow] {
+        guard let queue = writeBehindQueue, !queue.isEmpty else { return rows }
+        return rows.map { overlayingPendingWrites($0) }
+    }
+
+    /// Show an enqueued update in `rows` right away and announce it as an updated row
+    private func publishPendingWrite(id: String) {
+        let canonical = ZyraSync.canonicalId(id)
+        guard let index = rows.firstIndex(where: { $0.string(primaryKey).map(ZyraSync.canonicalId) == canonical }) else {
+            return
+        }
+
+        rows[index] = overlayingPendingWrites(rows[index])
+        publishChanges(ZyraChangeSet(
+            inserted: [],
+            updated: [ZyraRowChange(id: rows[index].string(primaryKey) ?? id, index: index)],
+            removed: [],
+            moved: [],
+            isReset: false
+        ))
+    }
+
+    // MARK: - Change Sets
+    
+    /// Stream of keyed change sets, one per watch emission that changed something
+    /// Consume this to apply deltas instead of re-rendering `records` wholesale
+    /// Every change set is delivered (unbounded buffer) after `records` has been updated
+    public func changeStream() -> AsyncStream<ZyraChangeSet> {
+        return AsyncStream { continuation in
+            let id = UUID()
+            changeContinuations[id] = continuation
+            continuation.onTermination = { [weak self] _ in
+                Task { @MainActor in
+                    self?.changeContinuations[id] = nil
+                }
+            }
+        }
+    }
+    
+    private func publishChanges(_ changes: ZyraChangeSet) {
+        for continuation in changeContinuations.values {
+            continuation.yield(changes)
+        }
+    }
 
     // MARK: - Read Operations
 
@@ -104,6 +314,9 @@ public class ZyraSync: ObservableObject {
     ///   - encryptedFields: Array of field names that should be decrypted
     ///   - integerFields: Array of field names that are integers (stored as encrypted text)
     ///   - booleanFields: Array of field names that are booleans (stored as encrypted text)
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
+    ///
+    /// Returns once the first snapshot has been decoded and published to `records`
     public func loadRecords(
         fields: [String] = ["*"],
         whereClause: String? = nil,
@@ -111,34 +324,18 @@ public class ZyraSync: ObservableObject {
         orderBy: String = "created_at DESC",
         encryptedFields: [String] = [],
         integerFields: [String] = [],
-        booleanFields: [String] = []
+        booleanFields: [String] = [],
+        timeout: TimeInterval? = nil
     ) async throws {
-        // Build SELECT clause
-        let selectClause = fields.contains("*") ? "*" : fields.map { "\"\($0)\"" }.joined(separator: ", ")
-        var query = "SELECT \(selectClause) FROM \"\(tableName)\""
-        var queryParams: [Any] = []
-
-        // Add WHERE clause if provided
-        if let whereClause = whereClause, !whereClause.isEmpty {
-            query += " WHERE \(whereClause)"
-            queryParams.append(contentsOf: parameters)
-        }
-        // Note: Removed default user_id filtering - callers must explicitly provide whereClause if filtering is needed
-
-        // Add ORDER BY
-        query += " ORDER BY \(orderBy)"
-
-        // Build list of fields to read from cursor
-        let fieldsToRead: [String]
-        if fields.contains("*") {
-            var commonFields = ["id", "user_id", "owner_id", "created_at", "updated_at"]
-            commonFields.append(contentsOf: encryptedFields)
-            commonFields.append(contentsOf: integerFields)
-            commonFields.append(contentsOf: booleanFields)
-            fieldsToRead = Array(Set(commonFields))
-        } else {
-            fieldsToRead = fields
-        }
+        let (query, queryParams, fieldsToRead) = buildSelect(
+            fields: fields,
+            whereClause: whereClause,
+            parameters: parameters,
+            orderBy: orderBy,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields
+        )
 
         // Store watch configuration for continuous watching
         currentWatchQuery = query
@@ -146,81 +343,53 @@ public class ZyraSync: ObservableObject {
         currentWatchFields = fieldsToRead
         currentWatchConfig = (encryptedFields, integerFields, booleanFields)
 
-        // Cancel existing watch if query changed
-        let queryString = "\(query)|\(queryParams.map { "\($0)" }.joined(separator: ","))"
-        if watchTask != nil {
-            watchTask?.cancel()
-        }
+        // Compile the decode plan once for this query
+        // An explicit field list is the SELECT list, so cursor indices are known up front
+        let plan = ZyraDecodePlan(
+            fields: fieldsToRead,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields,
+            fieldsMatchSelectOrder: !fields.contains("*")
+        )
 
-        // Start continuous watch in background task
-        watchTask = Task { [weak self] in
-            guard let self = self else { return }
-            
-            do {
-                ZyraFormLogger.debug("🔍 Starting PowerSync watch for \(self.tableName)")
-                
-                for try await results in try self.powerSync.watch(
-                    sql: query,
-                    parameters: queryParams,
-                    mapper: { cursor in
-                        var dict: [String: Any] = [:]
-
-                        // Read each field
-                        for fieldName in fieldsToRead {
-                            if encryptedFields.contains(fieldName) {
-                                if let encryptedValue = try? cursor.getStringOptional(name: fieldName) {
-                                    if let decrypted = try? self.encryptionManager.decryptIfEnabled(encryptedValue, for: self.userId) {
-                                        if integerFields.contains(fieldName), let intValue = Int(decrypted) {
-                                            dict[fieldName] = intValue
-                                        } else if booleanFields.contains(fieldName) {
-                                            dict[fieldName] = decrypted == "true" || decrypted == "1"
-                                        } else {
-                                            dict[fieldName] = decrypted
-                                        }
-                                    } else {
-                                        dict[fieldName] = encryptedValue
-                                    }
-                                } else {
-                                    dict[fieldName] = nil
-                                }
-                            } else if integerFields.contains(fieldName) {
-                                dict[fieldName] = try? cursor.getIntOptional(name: fieldName)
-                            } else if booleanFields.contains(fieldName) {
-                                if let intValue = try? cursor.getIntOptional(name: fieldName) {
-                                    dict[fieldName] = intValue == 1
-                                } else if let strValue = try? cursor.getStringOptional(name: fieldName) {
-                                    dict[fieldName] = strValue == "true" || strValue == "1"
-                                }
-                            } else {
-                                if let strValue = try? cursor.getStringOptional(name: fieldName) {
-                                    dict[fieldName] = strValue
-                                } else if let intValue = try? cursor.getIntOptional(name: fieldName) {
-                                    dict[fieldName] = intValue
-                                } else if let doubleValue = try? cursor.getDoubleOptional(name: fieldName) {
-                                    dict[fieldName] = doubleValue
-                                }
-                            }
-                        }
-
-                        return dict
-                    }
-                ) {
-                    // Update records whenever PowerSync emits new data
-                    await MainActor.run {
-                        self.records = results
-                        ZyraFormLogger.debug("🔄 PowerSync watch updated: \(results.count) records from \(self.tableName)")
-                    }
-                }
-            } catch {
-                if !(error is CancellationError) {
-                    ZyraFormLogger.error("❌ PowerSync watch error for \(self.tableName): \(error.localizedDescription)")
-                }
-            }
-        }
+        // Start (or join) the continuous watch for this query
+        ZyraFormLogger.debug("🔍 Starting PowerSync watch for \(tableName)")
+        startWatch(sql: query, parameters: queryParams, plan: plan, source: tableName)
+        
+        // Wait for the first snapshot to be published
+        let elapsed = try await waitForFirstSnapshot(timeout: timeout)
+        ZyraFormLogger.debug("✅ Watch started for \(tableName) (first snapshot in \(String(format: "%.1f", elapsed * 1000)) ms)")
+    }
+    
+    /// Load records with a typed query
+    /// The query's SQL and decode plan are compiled once per query shape and reused from the table's cache
+    ///
+    /// **Example Usage:**
+    /// ```swift
+    /// try await service.loadRecords(query: todos.query().where("user_id", equals: userId).limit(50))
+    /// ```
+    ///
+    /// - Parameters:
+    ///   - query: Query against this service's table
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func loadRecords(query: ZyraQuery, timeout: TimeInterval? = nil) async throws {
+        let compiled = try query.compile()
+        let parameters = try resolvingBlindValues(query.parameters)
+        let config = query.table.fieldConfig
+        
+        // Store watch configuration for continuous watching
+        currentWatchQuery = compiled.sql
+        currentWatchParams = parameters
+        currentWatchFields = compiled.fields
+        currentWatchConfig = (config.encryptedFields, config.integerFields, config.booleanFields)
+        
+        ZyraFormLogger.debug("🔍 Starting PowerSync watch for \(tableName)")
+        startWatch(sql: compiled.sql, parameters: parameters, plan: compiled.plan, source: tableName)
         
-        // Wait for initial load
-        try await Task.sleep(nanoseconds: 100_000_000) // 0.1 second
-        ZyraFormLogger.debug("✅ Watch started for \(tableName)")
+        let elapsed = try await waitForFirstSnapshot(timeout: timeout)
+        ZyraFormLogger.debug("✅ Watch started for \(tableName) (first snapshot in \(String(format: "%.1f", elapsed * 1000)) ms)")
     }
     
     /// Load records using a raw SQL query for advanced filtering
@@ -254,13 +423,17 @@ public class ZyraSync: ObservableObject {
     ///   - encryptedFields: Array of field names that should be decrypted
     ///   - integerFields: Array of field names that are integers (stored as encrypted text)
     ///   - booleanFields: Array of field names that are booleans (stored as encrypted text)
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
+    ///
+    /// Returns once the first snapshot has been decoded and published to `records`
     public func loadRecordsWithRawSQL(
         sql: String,
         parameters: [Any] = [],
         fieldsToRead: [String],
         encryptedFields: [String] = [],
         integerFields: [String] = [],
-        booleanFields: [String] = []
+        booleanFields: [String] = [],
+        timeout: TimeInterval? = nil
     ) async throws {
         // Store watch configuration for continuous watching
         currentWatchQuery = sql
@@ -268,230 +441,880 @@ public class ZyraSync: ObservableObject {
         currentWatchFields = fieldsToRead
         currentWatchConfig = (encryptedFields, integerFields, booleanFields)
         
-        // Cancel existing watch if query changed
-        let queryString = "\(sql)|\(parameters.map { "\($0)" }.joined(separator: ","))"
-        if watchTask != nil {
-            watchTask?.cancel()
+        // Compile the decode plan once for this query
+        // Column indices are resolved from the cursor on the first row
+        let plan = ZyraDecodePlan(
+            fields: fieldsToRead,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields
+        )
+        
+        // Start (or join) the continuous watch for this query
+        ZyraFormLogger.debug("🔍 Starting PowerSync watch with raw SQL for \(tableName)")
+        startWatch(sql: sql, parameters: parameters, plan: plan, source: "raw SQL query")
+        
+        // Wait for the first snapshot to be published
+        let elapsed = try await waitForFirstSnapshot(timeout: timeout)
+        ZyraFormLogger.debug("✅ Watch started for raw SQL query (first snapshot in \(String(format: "%.1f", elapsed * 1000)) ms)")
+    }
+
+    
+    // MARK: - Snapshot Queries
+    
+    /// Read records once, without starting or touching the watch
+    /// Uses the same decode plan, decrypt cache and off-main decoding as `loadRecords`,
+    /// but returns the rows directly instead of publishing them to `records`
+    ///
+    /// **Example Usage:**
+    /// ```swift
+    /// let open = try await service.fetchRecords(whereClause: "is_completed = ?", parameters: ["false"])
+    /// ```
+    ///
+    /// - Parameters:
+    ///   - fields: Array of field names to retrieve (use ["*"] for all fields)
+    ///   - whereClause: Optional WHERE clause (without "WHERE" keyword)
+    ///   - parameters: Parameters for the WHERE clause (use ? placeholders for safety)
+    ///   - orderBy: ORDER BY clause, e.g., "created_at DESC"
+    ///   - limit: Optional maximum number of rows
+    ///   - encryptedFields: Array of field names that should be decrypted
+    ///   - integerFields: Array of field names that are integers
+    ///   - booleanFields: Array of field names that are booleans
+    /// - Returns: Decoded rows, in query order
+    public func fetchRecords(
+        fields: [String] = ["*"],
+        whereClause: String? = nil,
+        parameters: [Any] = [],
+        orderBy: String = "created_at DESC",
+        limit: Int? = nil,
+        encryptedFields: [String] = [],
+        integerFields: [String] = [],
+        booleanFields: [String] = []
+    ) async throws -> [[String: Any]] {
+        return try await fetchRows(
+            fields: fields,
+            whereClause: whereClause,
+            parameters: parameters,
+            orderBy: orderBy,
+            limit: limit,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields
+        ).map { $0.dictionary }
+    }
+    
+    /// Read rows once in compact form (see `fetchRecords`)
+    public func fetchRows(
+        fields: [String] = ["*"],
+        whereClause: String? = nil,
+        parameters: [Any] = [],
+        orderBy: String = "created_at DESC",
+        limit: Int? = nil,
+        encryptedFields: [String] = [],
+        integerFields: [String] = [],
+        booleanFields: [String] = []
+    ) async throws -> [ZyraRow] {
+        let select = buildSelect(
+            fields: fields,
+            whereClause: whereClause,
+            parameters: parameters,
+            orderBy: orderBy,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields
+        )
+        var query = select.sql
+        if let limit = limit {
+            query += " LIMIT \(limit)"
         }
         
-        // Start continuous watch in background task
-        watchTask = Task { [weak self] in
-            guard let self = self else { return }
+        return try await fetch(
+            sql: query,
+            parameters: select.parameters,
+            plan: ZyraDecodePlan(
+                fields: select.fieldsToRead,
+                encryptedFields: encryptedFields,
+                integerFields: integerFields,
+                booleanFields: booleanFields,
+                fieldsMatchSelectOrder: !fields.contains("*")
+            )
+        )
+    }
+    
+    /// Read one record by primary key, without starting or touching the watch
+    /// - Returns: The decoded row, or nil when no row has this ID
+    public func fetchRecord(
+        id: String,
+        fields: [String] = ["*"],
+        encryptedFields: [String] = [],
+        integerFields: [String] = [],
+        booleanFields: [String] = []
+    ) async throws -> [String: Any]? {
+        return try await fetchRecords(
+            fields: fields,
+            whereClause: "\"\(primaryKey)\" = ?",
+            parameters: [id],
+            limit: 1,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields
+        ).first
+    }
+    
+    /// Read records matching a typed query once, without starting or touching the watch
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func fetchRecords(query: ZyraQuery) async throws -> [[String: Any]] {
+        return try await fetchRows(query: query).map { $0.dictionary }
+    }
+    
+    /// Read rows matching a typed query once in compact form
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func fetchRows(query: ZyraQuery) async throws -> [ZyraRow] {
+        let compiled = try query.compile()
+        return try await fetch(sql: compiled.sql, parameters: try resolvingBlindValues(query.parameters), plan: compiled.plan)
+    }
+    
+    /// Run a raw SQL query once, without starting or touching the watch
+    /// - Parameters:
+    ///   - sql: Complete SQL SELECT query
+    ///   - parameters: Parameters for the SQL query (use ? placeholders)
+    ///   - fieldsToRead: Array of field names to read from the result cursor
+    ///   - encryptedFields: Array of field names that should be decrypted
+    ///   - integerFields: Array of field names that are integers
+    ///   - booleanFields: Array of field names that are booleans
+    /// - Returns: Decoded rows, in query order
+    public func fetchRecordsWithRawSQL(
+        sql: String,
+        parameters: [Any] = [],
+        fieldsToRead: [String],
+        encryptedFields: [String] = [],
+        integerFields: [String] = [],
+        booleanFields: [String] = []
+    ) async throws -> [[String: Any]] {
+        return try await fetchRowsWithRawSQL(
+            sql: sql,
+            parameters: parameters,
+            fieldsToRead: fieldsToRead,
+            encryptedFields: encryptedFields,
+            integerFields: integerFields,
+            booleanFields: booleanFields
+        ).map { $0.dictionary }
+    }
+    
+    /// Run a raw SQL query once and return compact rows (see `fetchRecordsWithRawSQL`)
+    public func fetchRowsWithRawSQL(
+        sql: String,
+        parameters: [Any] = [],
+        fieldsToRead: [String],
+        encryptedFields: [String] = [],
+        integerFields: [String] = [],
+        booleanFields: [String] = []
+    ) async throws -> [ZyraRow] {
+        return try await fetch(
+            sql: sql,
+            parameters: parameters,
+            plan: ZyraDecodePlan(
+                fields: fieldsToRead,
+                encryptedFields: encryptedFields,
+                integerFields: integerFields,
+                booleanFields: booleanFields
+            )
+        )
+    }
+    
+    /// Single read through `getAll`, decoded off the main actor
+    func fetch(sql: String, parameters: [Any], plan: ZyraDecodePlan) async throws -> [ZyraRow] {
+        let decoder = ZyraRowDecoder(
+            plan: plan,
+            userId: userId,
+            encryptionManager: encryptionManager,
+            primaryKey: primaryKey,
+            decryptCache: decryptCache
+        )
+        
+        let rawRows = try await powerSync.getAll(
+            sql: sql,
+            parameters: parameters,
+            mapper: { cursor in
+                decoder.read(cursor)
+            }
+        )
+        let rows = await decodeExecutor.decode(rawRows, with: decoder)
+        return overlayingPendingWrites(rows)
+    }
+    
+    /// Build the SELECT statement shared by `loadRecords` and `fetchRecords`
+    /// - Returns: The SQL, its parameters, and the field names to read from the cursor
+    private func buildSelect(
+        fields: [String],
+        whereClause: String?,
+        parameters: [Any],
+        orderBy: String,
+        encryptedFields: [String],
+        integerFields: [String],
+        booleanFields: [String]
+    ) -> (sql: String, parameters: [Any], fieldsToRead: [String]) {
+        // Build SELECT clause
+        let selectClause = fields.contains("*") ? "*" : fields.map { "\"\($0)\"" }.joined(separator: ", ")
+        var query = "SELECT \(selectClause) FROM \"\(tableName)\""
+        var queryParams: [Any] = []
+
+        // Add WHERE clause if provided
+        if let whereClause = whereClause, !whereClause.isEmpty {
+            query += " WHERE \(whereClause)"
+            queryParams.append(contentsOf: parameters)
+        }
+        // Note: Removed default user_id filtering - callers must explicitly provide whereClause if filtering is needed
+
+        // Add ORDER BY
+        query += " ORDER BY \(orderBy)"
+
+        // Build list of fields to read from cursor
+        let fieldsToRead: [String]
+        if fields.contains("*") {
+            var commonFields = ["id", "user_id", "owner_id", "created_at", "updated_at"]
+            commonFields.append(contentsOf: encryptedFields)
+            commonFields.append(contentsOf: integerFields)
+            commonFields.append(contentsOf: booleanFields)
+            fieldsToRead = Array(Set(commonFields))
+        } else {
+            fieldsToRead = fields
+        }
+        
+        return (query, queryParams, fieldsToRead)
+    }
+    
+    /// Subscribe to the shared watch for a query through `ZyraWatchHub`
+    /// Instances watching the same query share one PowerSync watch and one decode per emission;
+    /// this instance only publishes the results to `rows` and its change stream on the main actor
+    /// Replaces the previous subscription and `watchReadiness`, which resolves once the first snapshot is published
+    private func startWatch(sql: String, parameters: [Any], plan: ZyraDecodePlan, source: String) {
+        let readiness = ZyraWatchReadiness()
+        
+        // Waiters on a replaced watch return normally; the new watch publishes over it
+        watchReadiness?.supersede()
+        watchReadiness = readiness
+        timeToFirstRow = nil
+        
+        let previous = watchSubscription
+        watchSubscription = subscribe(sql: sql, parameters: parameters, plan: plan) { [weak self] event in
+            // Ignore events still in flight for a subscription this instance has replaced
+            guard let self = self, self.watchReadiness === readiness else { return }
             
-            do {
-                ZyraFormLogger.debug("🔍 Starting PowerSync watch with raw SQL for \(self.tableName)")
-                
-                for try await results in try self.powerSync.watch(
-                    sql: sql,
-                    parameters: parameters,
-                    mapper: { cursor in
-                        var dict: [String: Any] = [:]
-                        
-                        // Read each field
-                        for fieldName in fieldsToRead {
-                            if encryptedFields.contains(fieldName) {
-                                if let encryptedValue = try? cursor.getStringOptional(name: fieldName) {
-                                    if let decrypted = try? self.encryptionManager.decryptIfEnabled(encryptedValue, for: self.userId) {
-                                        if integerFields.contains(fieldName), let intValue = Int(decrypted) {
-                                            dict[fieldName] = intValue
-                                        } else if booleanFields.contains(fieldName) {
-                                            dict[fieldName] = decrypted == "true" || decrypted == "1"
-                                        } else {
-                                            dict[fieldName] = decrypted
-                                        }
-                                    } else {
-                                        dict[fieldName] = encryptedValue
-                                    }
-                                } else {
-                                    dict[fieldName] = nil
-                                }
-                            } else if integerFields.contains(fieldName) {
-                                dict[fieldName] = try? cursor.getIntOptional(name: fieldName)
-                            } else if booleanFields.contains(fieldName) {
-                                if let intValue = try? cursor.getIntOptional(name: fieldName) {
-                                    dict[fieldName] = intValue == 1
-                                } else if let strValue = try? cursor.getStringOptional(name: fieldName) {
-                                    dict[fieldName] = strValue == "true" || strValue == "1"
-                                }
-                            } else {
-                                if let strValue = try? cursor.getStringOptional(name: fieldName) {
-                                    dict[fieldName] = strValue
-                                } else if let intValue = try? cursor.getIntOptional(name: fieldName) {
-                                    dict[fieldName] = intValue
-                                } else if let doubleValue = try? cursor.getDoubleOptional(name: fieldName) {
-                                    dict[fieldName] = doubleValue
-                                }
-                            }
-                        }
-                        
-                        return dict
-                    }
-                ) {
-                    // Update records whenever PowerSync emits new data
-                    await MainActor.run {
-                        self.records = results
-                        ZyraFormLogger.debug("🔄 PowerSync watch updated: \(results.count) records from raw SQL query")
-                    }
-                }
-            } catch {
-                if !(error is CancellationError) {
-                    ZyraFormLogger.error("❌ PowerSync watch error for raw SQL query: \(error.localizedDescription)")
+            switch event {
+            case .snapshot(let results, let changes):
+                // Update records whenever PowerSync emits new data
+                self.rows = self.overlayingPendingWrites(results)
+                self.publishChanges(changes)
+                if let elapsed = readiness.succeed() {
+                    self.timeToFirstRow = elapsed
                 }
+                ZyraFormLogger.debug("🔄 PowerSync watch updated: \(results.count) records from \(source) (\(changes.inserted.count) inserted, \(changes.updated.count) updated, \(changes.removed.count) removed)")
+            case .failure(let error):
+                readiness.fail(error)
+                // The shared watch is gone; `isWatching` turns false and `resumeWatching()` starts a new one
+                self.watchSubscription?.cancel()
+                self.watchSubscription = nil
+                ZyraFormLogger.error("❌ PowerSync watch error for \(source): \(error.localizedDescription)")
+            }
+        }
+        // Leave the previous watch after joining the new one, so re-running the same query keeps it alive
+        previous?.cancel()
+    }
+
+    // MARK: - Paging
+    
+    /// Keyset-paged, windowed watch over a large query
+    /// Only the visible page is decoded and watched, so memory and refresh time do not grow with the table
+    /// - Parameters:
+    ///   - query: Filters and ordering; its first ordering (or the table's `defaultOrderBy`) is the page key
+    ///   - pageSize: Rows per page
+    /// - Returns: Pager; call `start()` to load the first page
+    public func pager(query: ZyraQuery, pageSize: Int = 50) -> ZyraPager {
+        return ZyraPager(service: self, query: query, pageSize: pageSize)
+    }
+    
+    /// Join the shared watch for a query with this service's user, keys and coalescing
+    func subscribe(
+        sql: String,
+        parameters: [Any],
+        plan: ZyraDecodePlan,
+        handler: @escaping (ZyraWatchHub.Event) -> Void
+    ) -> ZyraWatchSubscription {
+        return ZyraWatchHub.shared.subscribe(
+            database: powerSync,
+            sql: sql,
+            parameters: parameters,
+            plan: plan,
+            userId: userId,
+            primaryKey: primaryKey,
+            encryptionManager: encryptionManager,
+            decryptCache: decryptCache,
+            executor: decodeExecutor,
+            coalescing: watchCoalescing,
+            handler: handler
+        )
+    }
+    
+    /// Table this service reads (used by `TypedZyraSync`)
+    var table: String {
+        return tableName
+    }
+
+    // MARK: - Aggregates
+    
+    /// Run an aggregate in SQLite; only the result rows cross into Swift, nothing is decrypted
+    /// - Returns: One row per group (a single row without GROUP BY), columns named by `compile().layout`
+    /// - Throws: `ZyraQueryError` when a column is not in the schema or cannot be aggregated
+    public func aggregate(_ query: ZyraAggregateQuery) async throws -> [ZyraRow] {
+        let compiled = try query.compile()
+        return try await powerSync.getAll(
+            sql: compiled.sql,
+            parameters: try resolvingBlindValues(query.parameters),
+            mapper: { cursor in
+                compiled.read(cursor)
             }
+        )
+    }
+    
+    /// Number of rows matching a query's filters
+    public func count(_ query: ZyraQuery) async throws -> Int {
+        return try await aggregate(query.aggregate(.count())).first?.value("count").intValue ?? 0
+    }
+    
+    /// Live aggregate: re-runs in SQLite whenever the table changes, throttled like the record watch
+    /// Holds only the latest result rows, so live counters cost the same regardless of table size
+    /// - Returns: Stream of result rows; cancel the consuming task to stop watching
+    public func watchAggregate(_ query: ZyraAggregateQuery) throws -> AsyncThrowingStream<[ZyraRow], Error> {
+        let compiled = try query.compile()
+        return try powerSync.watch(
+            options: WatchOptions(
+                sql: compiled.sql,
+                parameters: try resolvingBlindValues(query.parameters),
+                throttle: watchCoalescing.minimumInterval,
+                mapper: { cursor in
+                    compiled.read(cursor)
+                }
+            )
+        )
+    }
+    
+    /// Live count of rows matching a query's filters (see `watchAggregate(_:)`)
+    public func watchCount(_ query: ZyraQuery) throws -> AsyncThrowingMapSequence<AsyncThrowingStream<[ZyraRow], Error>, Int> {
+        return try watchAggregate(query.aggregate(.count())).map { rows in
+            rows.first?.value("count").intValue ?? 0
         }
+    }
+
+    // MARK: - Search
+    
+    /// Ranked full-text search over the table's searchable columns, through its FTS5 index
+    /// - Parameters:
+    ///   - text: Words typed by the user; each is matched as a prefix (see `ZyraSearch.matchExpression(for:)`)
+    ///   - query: Filters applied to the matches (its ordering, limit and offset do not apply) and the columns to read
+    ///   - limit: Maximum number of rows
+    /// - Returns: Matching rows, best match first (empty for blank text)
+    /// - Throws: `ZyraQueryError` when a column is not in the schema; a database error when the index is not installed
+    public func searchRows(_ text: String, query: ZyraQuery, limit: Int = 50) async throws -> [ZyraRow] {
+        guard let match = ZyraSearch.matchExpression(for: text) else { return [] }
+        
+        let table = query.table
+        let fields = query.projection ?? table.fieldConfig.allFields
+        let sql = try table.searchSQL(fields: fields, predicates: query.predicates)
+        
+        var parameters: [Any] = [match]
+        parameters.append(contentsOf: try resolvingBlindValues(query.values))
+        parameters.append(limit)
         
-        // Wait for initial load
-        try await Task.sleep(nanoseconds: 100_000_000) // 0.1 second
-        ZyraFormLogger.debug("✅ Watch started for raw SQL query")
+        return try await fetch(
+            sql: sql,
+            parameters: parameters,
+            plan: ZyraDecodePlan(config: table.fieldConfig, fields: fields, fieldsMatchSelectOrder: true)
+        )
+    }
+
+    // MARK: - Blind Index
+    
+    /// Text an encrypted field stores for a value (before encryption)
+    nonisolated static func plaintext(of value: Any) -> String {
+        if let str = value as? String {
+            return str
+        } else if let intValue = value as? Int {
+            return String(intValue)
+        } else if let boolValue = value as? Bool {
+            return boolValue ? "true" : "false"
+        }
+        return String(describing: value)
+    }
+    
+    /// Blind-index token stored next to an encrypted value (NULL for a NULL value)
+    func blindIndexToken(_ value: Any?, field: String) throws -> Any {
+        guard let value = value, !(value is NSNull) else { return NSNull() }
+        return try encryptionManager.blindIndex(ZyraSync.plaintext(of: value), field: field, for: userId)
+    }
+    
+    /// Query parameters with blind-indexed plaintexts replaced by this user's tokens
+    func resolvingBlindValues(_ parameters: [Any]) throws -> [Any] {
+        guard parameters.contains(where: { $0 is ZyraBlindValue }) else { return parameters }
+        return try parameters.map { parameter in
+            guard let blind = parameter as? ZyraBlindValue else { return parameter }
+            return try blindIndexToken(blind.plaintext, field: blind.field)
+        }
+    }
+
+    // MARK: - Create Operations
+
+    /// Create a new record
+    /// - Parameters:
+    ///   - fields: Dictionary of field names to values
+    ///   - encryptedFields: Array of field names that should be encrypted
+    ///   - blindIndexedFields: Encrypted fields whose blind-index token column is written too
+    ///   - autoGenerateId: Whether to auto-generate a UUID for the id field
+    ///   - autoTimestamp: Whether to automatically add created_at and updated_at timestamps
+    public func createRecord(
+        fields: [String: Any],
+        encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
+        autoGenerateId: Bool = true,
+        autoTimestamp: Bool = true
+    ) async throws -> String {
+        let row = try insertRow(
+            fields: fields,
+            encryptedFields: Set(encryptedFields),
+            blindIndexedFields: blindIndexedFields,
+            autoGenerateId: autoGenerateId,
+            autoTimestamp: autoTimestamp,
+            now: ZyraTimestamp.now()
+        )
+
+        let query = writeStatements.insertSQL(columns: row.columns, rowCount: 1)
+        try await powerSync.execute(sql: query, parameters: row.values)
+
+        // No need to reload - PowerSync watch will automatically update records
+        ZyraFormLogger.info("✅ Created record in \(tableName): \(row.id)")
+        return row.id
+    }
+
+    /// Id, columns and encrypted values of a record about to be inserted
+    /// Columns are the id, then the remaining fields in schema order, so records with the same fields share one shape
+    private func insertRow(
+        fields: [String: Any],
+        encryptedFields: Set<String>,
+        blindIndexedFields: [String],
+        autoGenerateId: Bool,
+        autoTimestamp: Bool,
+        now: String
+    ) throws -> (id: String, columns: [String], values: [Any]) {
+        let id: String
+        if autoGenerateId {
+            // Always generate a new ID if auto-generating, even if one exists
+            id = ZyraSync.canonicalId(UUID().uuidString)
+        } else {
+            // Use provided ID or generate one if missing
+            id = ZyraSync.canonicalId(fields["id"] as? String ?? UUID().uuidString)
+        }
+
+        let stored = try storedFields(fields, encryptedFields: encryptedFields, blindIndexedFields: blindIndexedFields)
+        let row = ZyraSync.insertRow(id: id, stored: stored, autoTimestamp: autoTimestamp, now: now, order: columnOrder)
+        return (id, row.columns, row.values)
+    }
+
+    /// Insert columns and values of already encrypted fields
+    nonisolated private static func insertRow(
+        id: String,
+        stored: [String: Any],
+        autoTimestamp: Bool,
+        now: String,
+        order: ZyraColumnOrder
+    ) -> (columns: [String], values: [Any]) {
+        var allFields = stored
+        if autoTimestamp {
+            allFields["created_at"] = allFields["created_at"] ?? now
+            allFields["updated_at"] = allFields["updated_at"] ?? now
+        }
+
+        // Note: user_id is only added if the table has a user_id column
+        // Remove this if your table doesn't support user_id filtering
+        // if allFields["user_id"] == nil {
+        //     allFields["user_id"] = userId
+        // }
+
+        // Ensure ID is first in the field list for PowerSync to properly track it
+        allFields["id"] = nil
+        let columns = ["id"] + order.ordered(allFields.keys)
+        var values: [Any] = [id]
+        values.reserveCapacity(columns.count)
+        for fieldName in columns.dropFirst() {
+            values.append(allFields[fieldName]!)
+        }
+        return (columns, values)
+    }
+
+    /// Fields as they are stored: encrypted fields encrypted, blind-index tokens of blind-indexed fields added
+    /// Token columns passed in `fields` are replaced by freshly computed tokens
+    private func storedFields(
+        _ fields: [String: Any],
+        encryptedFields: Set<String>,
+        blindIndexedFields: [String]
+    ) throws -> [String: Any] {
+        var stored = fields
+        for field in blindIndexedFields {
+            let tokenColumn = ZyraTable.blindIndexColumn(for: field)
+            stored[tokenColumn] = nil
+            if fields.keys.contains(field) {
+                stored[tokenColumn] = try blindIndexToken(fields[field], field: field)
+            }
+        }
+        for (fieldName, value) in fields where encryptedFields.contains(fieldName) && !(value is NSNull) {
+            // Encrypt if needed; NSNull clears the column
+            stored[fieldName] = try encryptionManager.encryptIfEnabled(ZyraSync.plaintext(of: value), for: userId)
+        }
+        return stored
+    }
+
+    // MARK: - Update Operations
+
+    /// Update an existing record
+    /// With `writeBehind` set, the fields are merged into the record's pending update and written
+    /// when the window closes; reads of this service see them right away, and encryption or write
+    /// errors surface from the flush instead of this call
+    /// - Parameters:
+    ///   - id: The ID of the record to update
+    ///   - fields: Dictionary of field names to values (only provided fields will be updated)
+    ///   - encryptedFields: Array of field names that should be encrypted
+    ///   - blindIndexedFields: Encrypted fields whose blind-index token column is updated with them
+    ///   - autoTimestamp: Whether to automatically update updated_at timestamp
+    public func updateRecord(
+        id: String,
+        fields: [String: Any],
+        encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
+        autoTimestamp: Bool = true
+    ) async throws {
+        if let queue = writeBehindQueue {
+            queue.enqueue(ZyraPendingUpdate(
+                id: id,
+                fields: fields,
+                encryptedFields: Set(encryptedFields),
+                blindIndexedFields: Set(blindIndexedFields),
+                autoTimestamp: autoTimestamp
+            ))
+            publishPendingWrite(id: id)
+            ZyraFormLogger.debug("🕒 Queued update of \(tableName): \(id)")
+            return
+        }
+
+        let assignments = try updateAssignments(
+            fields: fields,
+            encryptedFields: Set(encryptedFields),
+            blindIndexedFields: blindIndexedFields,
+            autoTimestamp: autoTimestamp,
+            now: ZyraTimestamp.now()
+        )
+
+        // Add ID parameters for WHERE clause
+        let ids = ZyraSync.storedIds(id)
+        let query = writeStatements.updateSQL(columns: assignments.columns, idCount: ids.count)
+
+        try await powerSync.execute(sql: query, parameters: assignments.values + ids)
+
+        // No need to reload - PowerSync watch will automatically update records
+        ZyraFormLogger.info("✅ Updated record in \(tableName): \(id)")
+    }
+
+    /// Update every record matching a WHERE clause with one UPDATE statement
+    /// Encrypted values are encrypted once for the whole statement, not per row
+    /// - Parameters:
+    ///   - whereClause: SQL WHERE clause (without "WHERE" keyword), e.g., "project_id = ?"
+    ///   - parameters: Parameters for the WHERE clause
+    ///   - fields: Columns to set and their new values
+    ///   - encryptedFields: Array of field names that should be encrypted
+    ///   - blindIndexedFields: Encrypted fields whose blind-index token column is updated with them
+    ///   - autoTimestamp: Whether to automatically update updated_at timestamp
+    ///
+    /// Example: `updateRecords(where: "project_id = ?", parameters: [projectId], set: ["is_completed": true])`
+    public func updateRecords(
+        where whereClause: String,
+        parameters: [Any] = [],
+        set fields: [String: Any],
+        encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
+        autoTimestamp: Bool = true
+    ) async throws {
+        let assignments = try updateAssignments(
+            fields: fields,
+            encryptedFields: Set(encryptedFields),
+            blindIndexedFields: blindIndexedFields,
+            autoTimestamp: autoTimestamp,
+            now: ZyraTimestamp.now()
+        )
+        guard !assignments.columns.isEmpty else { return }
+
+        // Earlier write-behind updates must not land on top of this one
+        try await flushPendingWrites()
+
+        let query = "\(writeStatements.updateSQL(columns: assignments.columns)) WHERE \(whereClause)"
+        try await powerSync.execute(sql: query, parameters: assignments.values + parameters)
+
+        ZyraFormLogger.info("✅ Updated records in \(tableName) where \(whereClause)")
     }
 
+    /// Update every record matching a typed query's filters with one UPDATE statement
+    /// The query's ordering, limit, offset and projection do not apply
+    /// - Throws: `ZyraQueryError` when a filter does not fit the schema
+    public func updateRecords(
+        matching query: ZyraQuery,
+        set fields: [String: Any],
+        encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
+        autoTimestamp: Bool = true
+    ) async throws {
+        let assignments = try updateAssignments(
+            fields: fields,
+            encryptedFields: Set(encryptedFields),
+            blindIndexedFields: blindIndexedFields,
+            autoTimestamp: autoTimestamp,
+            now: ZyraTimestamp.now()
+        )
+        guard !assignments.columns.isEmpty else { return }
 
-    // MARK: - Create Operations
+        let filter = try ZyraQuery.whereClause(query.predicates, table: query.table)
+        try await flushPendingWrites()
+        try await powerSync.execute(
+            sql: writeStatements.updateSQL(columns: assignments.columns) + filter,
+            parameters: assignments.values + (try resolvingBlindValues(query.values))
+        )
 
-    /// Create a new record
+        ZyraFormLogger.info("✅ Updated records in \(tableName) matching query")
+    }
+
+    /// Update several records, each with its own fields, in one write transaction
+    /// Records setting the same columns share one statement shape
     /// - Parameters:
-    ///   - fields: Dictionary of field names to values
+    ///   - updates: Record id and the fields to set on it
     ///   - encryptedFields: Array of field names that should be encrypted
-    ///   - autoGenerateId: Whether to auto-generate a UUID for the id field
-    ///   - autoTimestamp: Whether to automatically add created_at and updated_at timestamps
-    public func createRecord(
-        fields: [String: Any],
+    ///   - blindIndexedFields: Encrypted fields whose blind-index token column is updated with them
+    ///   - autoTimestamp: Whether to automatically update updated_at timestamp
+    public func updateRecords(
+        _ updates: [(id: String, fields: [String: Any])],
         encryptedFields: [String] = [],
-        autoGenerateId: Bool = true,
+        blindIndexedFields: [String] = [],
         autoTimestamp: Bool = true
-    ) async throws -> String {
-        let id: String
-        if autoGenerateId {
-            // Always generate a new ID if auto-generating, even if one exists
-            id = UUID().uuidString
-        } else {
-            // Use provided ID or generate one if missing
-            id = fields["id"] as? String ?? UUID().uuidString
+    ) async throws {
+        guard !updates.isEmpty else { return }
+
+        try await flushPendingWrites()
+        try await writeUpdates(updates.map { update in
+            ZyraPendingUpdate(
+                id: update.id,
+                fields: update.fields,
+                encryptedFields: Set(encryptedFields),
+                blindIndexedFields: Set(blindIndexedFields),
+                autoTimestamp: autoTimestamp
+            )
+        })
+    }
+
+    /// One UPDATE per record, all in one write transaction (also the write-behind flush)
+    private func writeUpdates(_ updates: [ZyraPendingUpdate]) async throws {
+        let now = ZyraTimestamp.now()
+        var shapes = Set<[String]>()
+        var statements: [(sql: String, parameters: [Any])] = []
+        statements.reserveCapacity(updates.count)
+
+        for update in updates {
+            let assignments = try updateAssignments(
+                fields: update.fields,
+                encryptedFields: update.encryptedFields,
+                blindIndexedFields: Array(update.blindIndexedFields),
+                autoTimestamp: update.autoTimestamp,
+                now: now
+            )
+            guard !assignments.columns.isEmpty else { continue }
+
+            let ids = ZyraSync.storedIds(update.id)
+            shapes.insert(assignments.columns)
+            statements.append((writeStatements.updateSQL(columns: assignments.columns, idCount: ids.count), assignments.values + ids))
         }
-        let now = ISO8601DateFormatter().string(from: Date())
 
-        var allFields = fields
-        // Always ensure ID is set (either use provided or generated)
-        allFields["id"] = id
-        if autoTimestamp {
-            allFields["created_at"] = allFields["created_at"] ?? now
-            allFields["updated_at"] = allFields["updated_at"] ?? now
+        let batch = statements
+        try await powerSync.writeTransaction { transaction in
+            for statement in batch {
+                try transaction.execute(sql: statement.sql, parameters: statement.parameters)
+            }
         }
 
-        // Note: user_id is only added if the table has a user_id column
-        // Remove this if your table doesn't support user_id filtering
-        // if allFields["user_id"] == nil {
-        //     allFields["user_id"] = userId
-        // }
+        ZyraFormLogger.info("✅ Updated \(statements.count) records in \(tableName) (\(shapes.count) statement shapes, one transaction)")
+    }
 
-        // Build INSERT query
-        // Ensure ID is first in the field list for PowerSync to properly track it
-        var fieldNames = Array(allFields.keys)
-        if let idIndex = fieldNames.firstIndex(of: "id") {
-            fieldNames.remove(at: idIndex)
-            fieldNames.insert("id", at: 0)
-        }
-        let placeholders = fieldNames.map { _ in "?" }.joined(separator: ", ")
-        let columns = fieldNames.map { "\"\($0)\"" }.joined(separator: ", ")
-
-        var parameters: [Any] = []
-        for fieldName in fieldNames {
-            if let value = allFields[fieldName] {
-                // Encrypt if needed
-                if encryptedFields.contains(fieldName) {
-                    let stringValue: String
-                    if let str = value as? String {
-                        stringValue = str
-                    } else if let intValue = value as? Int {
-                        stringValue = String(intValue)
-                    } else if let boolValue = value as? Bool {
-                        stringValue = boolValue ? "true" : "false"} else {
-                        stringValue = String(describing: value)
-                    }
-                    let encrypted = try encryptionManager.encryptIfEnabled(stringValue, for: userId)
-                    parameters.append(encrypted)
-                } else {
-                    parameters.append(value)
-                }
-            } else {
-                parameters.append(NSNull())
+    /// Columns and encrypted values of an UPDATE's SET clause
+    /// Columns are the given fields and their blind-index tokens in schema order, then `updated_at`
+    private func updateAssignments(
+        fields: [String: Any],
+        encryptedFields: Set<String>,
+        blindIndexedFields: [String],
+        autoTimestamp: Bool,
+        now: String
+    ) throws -> (columns: [String], values: [Any]) {
+        let stored = try storedFields(fields, encryptedFields: encryptedFields, blindIndexedFields: blindIndexedFields)
+        return ZyraSync.updateAssignments(stored: stored, autoTimestamp: autoTimestamp, now: now, order: columnOrder)
+    }
+
+    /// SET columns and values of already encrypted fields
+    nonisolated private static func updateAssignments(
+        stored: [String: Any],
+        autoTimestamp: Bool,
+        now: String,
+        order: ZyraColumnOrder
+    ) -> (columns: [String], values: [Any]) {
+        var columns: [String] = []
+        var values: [Any] = []
+
+        for fieldName in order.ordered(stored.keys) {
+            // Skip ID field; updated_at is set below
+            if fieldName == "id" || (autoTimestamp && fieldName == "updated_at") {
+                continue
             }
+            columns.append(fieldName)
+            values.append(stored[fieldName]!)
         }
 
-        let query = """
-            INSERT INTO "\(tableName)"
-            (\(columns))
-            VALUES (\(placeholders))
-            """
+        // Always update updated_at if autoTimestamp is enabled
+        if autoTimestamp {
+            columns.append("updated_at")
+            values.append(now)
+        }
+        return (columns, values)
+    }
 
-        try await powerSync.execute(sql: query, parameters: parameters)
+    // MARK: - Upsert Operations
 
-        // No need to reload - PowerSync watch will automatically update records
-        ZyraFormLogger.info("✅ Created record in \(tableName): \(id)")
-        return id
+    /// Create a record, or update it when a record with its id exists (see `upsertRecords`)
+    /// - Returns: The record's id
+    public func upsertRecord(
+        fields: [String: Any],
+        encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
+        autoTimestamp: Bool = true
+    ) async throws -> String {
+        let ids = try await upsertRecords(
+            records: [fields],
+            encryptedFields: encryptedFields,
+            blindIndexedFields: blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+        return ids[0]
     }
 
-    // MARK: - Update Operations
-
-    /// Update an existing record
+    /// Create or update several records by id in one write transaction
+    /// PowerSync tables are views, which SQLite's `INSERT ... ON CONFLICT` does not support, so the
+    /// transaction reads which ids exist (`id IN (...)`), updates those rows and inserts the rest with
+    /// multi-row INSERTs. Every record is encrypted once, before the transaction starts
     /// - Parameters:
-    ///   - id: The ID of the record to update
-    ///   - fields: Dictionary of field names to values (only provided fields will be updated)
+    ///   - records: Field dictionaries; records without an `id` are always created
     ///   - encryptedFields: Array of field names that should be encrypted
-    ///   - autoTimestamp: Whether to automatically update updated_at timestamp
-    public func updateRecord(
-        id: String,
-        fields: [String: Any],
+    ///   - blindIndexedFields: Encrypted fields whose blind-index token column is written too
+    ///   - autoTimestamp: Set `updated_at`, and `created_at` on insert; an existing record keeps its `created_at`
+    /// - Returns: Ids of the records, in input order (a repeated id is written once, with its last fields)
+    public func upsertRecords(
+        records: [[String: Any]],
         encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
         autoTimestamp: Bool = true
-    ) async throws {
-        let now = ISO8601DateFormatter().string(from: Date())
+    ) async throws -> [String] {
+        guard !records.isEmpty else { return [] }
 
-        var updateFields: [String] = []
-        var parameters: [Any] = []
+        try await flushPendingWrites()
 
-        // Build dynamic UPDATE query
-        for (fieldName, value) in fields {
-            if fieldName == "id" {
-                continue // Skip ID field
-            }
+        let now = ZyraTimestamp.now()
+        let encryptedFieldSet = Set(encryptedFields)
+        var ids: [String] = []
+        ids.reserveCapacity(records.count)
+        var storedById: [String: [String: Any]] = [:]
+        var order: [String] = []
 
-            updateFields.append("\"\(fieldName)\" = ?")
-
-            // Encrypt if needed
-            if encryptedFields.contains(fieldName) {
-                let stringValue: String
-                if let str = value as? String {
-                    stringValue = str
-                } else if let intValue = value as? Int {
-                    stringValue = String(intValue)
-                } else if let boolValue = value as? Bool {
-                    stringValue = boolValue ? "true" : "false"} else {
-                    stringValue = String(describing: value)
-                }
-                let encrypted = try encryptionManager.encryptIfEnabled(stringValue, for: userId)
-                parameters.append(encrypted)
-            } else {
-                parameters.append(value)
+        for record in records {
+            let id = ZyraSync.canonicalId(record["id"] as? String ?? UUID().uuidString)
+            var fields = record
+            fields["id"] = nil
+            if autoTimestamp {
+                // Kept on insert, never changed on update
+                fields["created_at"] = fields["created_at"] ?? now
             }
-        }
+            let stored = try storedFields(fields, encryptedFields: encryptedFieldSet, blindIndexedFields: blindIndexedFields)
 
-        // Always update updated_at if autoTimestamp is enabled
-        if autoTimestamp {
-            updateFields.append("\"updated_at\" = ?")
-            parameters.append(now)
+            ids.append(id)
+            if storedById[id] == nil {
+                order.append(id)
+            }
+            storedById[id] = stored
         }
 
-        // Add ID parameter for WHERE clause
-        parameters.append(id)
+        let table = tableName
+        let writes = writeStatements
+        let columnOrder = self.columnOrder
+        let rows = order.map { (id: $0, stored: storedById[$0]!) }
+        let counts = try await powerSync.writeTransaction { transaction -> (inserted: Int, updated: Int) in
+            // Stored form of each id that already exists (ids written before canonicalization may be uppercase)
+            var existing: [String: String] = [:]
+            let lookups = rows.flatMap { ZyraSync.storedIds($0.id) }
+            for start in stride(from: 0, to: lookups.count, by: ZyraSync.maxParameters) {
+                let chunk = Array(lookups[start..<min(start + ZyraSync.maxParameters, lookups.count)])
+                let found = try transaction.getAll(
+                    sql: "SELECT id FROM \"\(table)\" WHERE id IN (\(ZyraSync.placeholders(chunk.count)))",
+                    parameters: chunk,
+                    mapper: { cursor in
+                        cursor.getStringOptional(index: 0) ?? ""
+                    }
+                )
+                for id in found {
+                    existing[ZyraSync.canonicalId(id)] = id
+                }
+            }
 
-        // Build query
-        let query = "UPDATE \"\(tableName)\" SET \(updateFields.joined(separator: ", ")) WHERE id = ?"
+            var inserts: [[String]: [[Any]]] = [:]
+            var insertShapes: [[String]] = []
+            var updated = 0
+            for row in rows {
+                if let storedId = existing[row.id] {
+                    var stored = row.stored
+                    if autoTimestamp {
+                        stored["created_at"] = nil
+                    }
+                    let assignments = ZyraSync.updateAssignments(stored: stored, autoTimestamp: autoTimestamp, now: now, order: columnOrder)
+                    guard !assignments.columns.isEmpty else { continue }
+                    try transaction.execute(
+                        sql: writes.updateSQL(columns: assignments.columns, idCount: 1),
+                        parameters: assignments.values + [storedId]
+                    )
+                    updated += 1
+                } else {
+                    let insert = ZyraSync.insertRow(id: row.id, stored: row.stored, autoTimestamp: autoTimestamp, now: now, order: columnOrder)
+                    if inserts[insert.columns] == nil {
+                        insertShapes.append(insert.columns)
+                    }
+                    inserts[insert.columns, default: []].append(insert.values)
+                }
+            }
 
-        try await powerSync.execute(sql: query, parameters: parameters)
+            var inserted = 0
+            for columns in insertShapes {
+                let shapeRows = inserts[columns]!
+                let rowsPerStatement = max(1, ZyraSync.maxParameters / columns.count)
+                for start in stride(from: 0, to: shapeRows.count, by: rowsPerStatement) {
+                    let chunk = shapeRows[start..<min(start + rowsPerStatement, shapeRows.count)]
+                    try transaction.execute(
+                        sql: writes.insertSQL(columns: columns, rowCount: chunk.count),
+                        parameters: Array(chunk.joined())
+                    )
+                    inserted += chunk.count
+                }
+            }
+            return (inserted, updated)
+        }
 
-        // No need to reload - PowerSync watch will automatically update records
-        ZyraFormLogger.info("✅ Updated record in \(tableName): \(id)")
+        ZyraFormLogger.info("✅ Upserted \(rows.count) records in \(tableName) (\(counts.inserted) created, \(counts.updated) updated, one transaction)")
+        return ids
     }
 
     // MARK: - Delete Operations
@@ -501,73 +1324,148 @@ public class ZyraSync: ObservableObject {
     /// - Parameter caseInsensitive: Whether to use case-insensitive ID matching
     public func deleteRecord(id: String, caseInsensitive: Bool = true) async throws {
         ZyraFormLogger.debug("🗑️ Deleting record from \(tableName) with ID: \(id)")
+        try await deleteRecords(ids: [id], caseInsensitive: caseInsensitive)
+    }
 
-        // Optional: Check if record exists
-        let checkQuery = caseInsensitive
-            ? "SELECT COUNT(*) as count FROM \"\(tableName)\" WHERE LOWER(id) = LOWER(?)": "SELECT COUNT(*) as count FROM \"\(tableName)\" WHERE id = ?"
-
-        do {
-            for try await results in try powerSync.watch(
-                sql: checkQuery,
-                parameters: [id],
-                mapper: { cursor in
-                    return try cursor.getInt(name: "count")
-                }
-            ) {
-                if let count = results.first {
-                    ZyraFormLogger.debug("🔍 Found \(count) record(s) matching ID")
-                }
-                break
-            }
-        } catch {
-            ZyraFormLogger.warning("⚠️ Error checking record existence: \(error.localizedDescription)")
-        }
+    // MARK: - Ids
 
-        // Execute DELETE
-        let deleteQuery = caseInsensitive
-            ? "DELETE FROM \"\(tableName)\" WHERE LOWER(id) = LOWER(?)": "DELETE FROM \"\(tableName)\" WHERE id = ?"
+    /// Ids are stored lowercased, so lookups compare with `=` / `IN` and seek the id index
+    nonisolated static func canonicalId(_ id: String) -> String {
+        return id.lowercased()
+    }
 
-        try await powerSync.execute(sql: deleteQuery, parameters: [id])
+    /// Stored forms an id may have: itself, its canonical form, and (case-insensitively) the
+    /// uppercase form `UUID().uuidString` produced before ids were canonicalized
+    /// Always three values when case-insensitive (repeats are harmless in `IN`), so the SQL has one shape
+    nonisolated static func storedIds(_ id: String, caseInsensitive: Bool = true) -> [String] {
+        guard caseInsensitive else { return [id] }
+        return [id, id.lowercased(), id.uppercased()]
+    }
 
-        // No need to reload - PowerSync watch will automatically update records
-        ZyraFormLogger.debug("✅ DELETE SQL executed")
-        ZyraFormLogger.info("✅ Record deletion completed - PowerSync will handle sync")
+    /// `?, ?, ...` with `count` placeholders
+    nonisolated static func placeholders(_ count: Int) -> String {
+        return ZyraWriteStatements.placeholders(count)
     }
 
     // MARK: - Batch Operations
 
-    /// Create multiple records at once
+    /// Batched statements bind at most this many values
+    /// (SQLite's default `SQLITE_MAX_VARIABLE_NUMBER` on older builds)
+    nonisolated static let maxParameters = 999
+
+    /// Create multiple records in one write transaction
+    /// Every record is encrypted before the transaction starts; records are then written with
+    /// multi-row INSERTs (records with the same fields share statements), so a large import is one
+    /// transaction and one sync batch instead of one per record
+    /// - Parameters:
+    ///   - records: Field dictionaries, one per record
+    ///   - encryptedFields: Array of field names that should be encrypted
+    ///   - blindIndexedFields: Encrypted fields whose blind-index token column is written too
+    ///   - autoGenerateId: Whether to auto-generate a UUID for the id field
+    ///   - autoTimestamp: Whether to automatically add created_at and updated_at timestamps
+    /// - Returns: Ids of the created records, in input order
     public func createRecords(
         records: [[String: Any]],
         encryptedFields: [String] = [],
+        blindIndexedFields: [String] = [],
         autoGenerateId: Bool = true,
         autoTimestamp: Bool = true
     ) async throws -> [String] {
+        guard !records.isEmpty else { return [] }
+
+        let now = ZyraTimestamp.now()
+        let encryptedFieldSet = Set(encryptedFields)
         var createdIds: [String] = []
+        createdIds.reserveCapacity(records.count)
 
+        // Group rows by shape, keeping shapes in first-seen order
+        var shapes: [[String]] = []
+        var rowsByShape: [[String]: [[Any]]] = [:]
         for record in records {
-            let id = try await createRecord(
+            let row = try insertRow(
                 fields: record,
-                encryptedFields: encryptedFields,
+                encryptedFields: encryptedFieldSet,
+                blindIndexedFields: blindIndexedFields,
                 autoGenerateId: autoGenerateId,
-                autoTimestamp: autoTimestamp
+                autoTimestamp: autoTimestamp,
+                now: now
             )
-            createdIds.append(id)
+            createdIds.append(row.id)
+            if rowsByShape[row.columns] == nil {
+                shapes.append(row.columns)
+            }
+            rowsByShape[row.columns, default: []].append(row.values)
+        }
+
+        var statements: [(sql: String, parameters: [Any])] = []
+        for columns in shapes {
+            let rows = rowsByShape[columns]!
+            let rowsPerStatement = max(1, ZyraSync.maxParameters / columns.count)
+
+            for start in stride(from: 0, to: rows.count, by: rowsPerStatement) {
+                let chunk = rows[start..<min(start + rowsPerStatement, rows.count)]
+                statements.append((writeStatements.insertSQL(columns: columns, rowCount: chunk.count), Array(chunk.joined())))
+            }
+        }
+
+        let batch = statements
+        try await powerSync.writeTransaction { transaction in
+            for statement in batch {
+                try transaction.execute(sql: statement.sql, parameters: statement.parameters)
+            }
         }
 
+        ZyraFormLogger.info("✅ Created \(createdIds.count) records in \(tableName) (\(statements.count) statements, one transaction)")
         return createdIds
     }
 
-    /// Delete multiple records by IDs
+    /// Delete multiple records by IDs in one write transaction
+    /// Ids are matched with `id IN (...)`, chunked to `maxParameters`, so each id is an index seek
+    /// - Parameter caseInsensitive: Also match the lowercase and uppercase forms of each id
     public func deleteRecords(ids: [String], caseInsensitive: Bool = true) async throws {
-        for id in ids {
-            try await deleteRecord(id: id, caseInsensitive: caseInsensitive)
+        var seen = Set<String>()
+        let stored = ids
+            .flatMap { ZyraSync.storedIds($0, caseInsensitive: caseInsensitive) }
+            .filter { seen.insert($0).inserted }
+        guard !stored.isEmpty else { return }
+
+        // Pending write-behind updates of deleted records have nothing left to update
+        writeBehindQueue?.discard(ids: ids)
+
+        var statements: [(sql: String, parameters: [Any])] = []
+        for start in stride(from: 0, to: stored.count, by: ZyraSync.maxParameters) {
+            let chunk = Array(stored[start..<min(start + ZyraSync.maxParameters, stored.count)])
+            statements.append((writeStatements.deleteSQL(idCount: chunk.count), chunk))
+        }
+
+        let batch = statements
+        try await powerSync.writeTransaction { transaction in
+            for statement in batch {
+                try transaction.execute(sql: statement.sql, parameters: statement.parameters)
+            }
         }
+
+        // No need to reload - PowerSync watch will automatically update records
+        ZyraFormLogger.info("✅ Deleted \(ids.count) record(s) from \(tableName) (\(statements.count) statements, one transaction)")
     }
 }
 
 // MARK: - Generic ZyraSync for ZyraModel
 
+/// Typed snapshot of a live watch: the current models and what changed since the previous snapshot
+public struct ZyraModelSnapshot<Model: ZyraModel> {
+    /// All models of the query, in query order
+    public let models: [Model]
+    /// Keyed changes against the previous snapshot; the first snapshot a consumer receives is a reset
+    public let changes: ZyraChangeSet
+
+    /// Models inserted or updated by this snapshot
+    public var changedModels: [Model] {
+        let indices = changes.inserted.map(\.index) + changes.updated.map(\.index)
+        return indices.sorted().map { models[$0] }
+    }
+}
+
 /// Generic ZyraSync service that works with ZyraModel types
 @MainActor
 public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
@@ -575,6 +1473,19 @@ public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
     
     @Published public var records: [Model] = []
     
+    private var watchSubscription: ZyraWatchSubscription?
+    private var watchReadiness: ZyraWatchReadiness?
+    private var recordIds: [String] = []
+    private var snapshotContinuations: [UUID: AsyncStream<ZyraModelSnapshot<Model>>.Continuation] = [:]
+    private var modelDecoder: ZyraModelDecoder<Model>?
+    
+    /// Reads complete rows for models loaded through a list projection
+    private lazy var detailLoader = ZyraDetailLoader(service: baseService, table: Model.schema, fields: Model.schema.fieldConfig.allFields)
+    private var detailedModels: [String: (version: String?, model: Model)] = [:]
+    
+    /// Columns the current watch does not read; listed models hold fallback values for them
+    private var unloadedFields: [String] = []
+    
     /// Initialize with model type (infers table name from schema)
     public init(
         userId: String,
@@ -586,8 +1497,10 @@ public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
             tableName: tableName,
             userId: userId,
             database: database,
-            encryptionManager: encryptionManager
+            encryptionManager: encryptionManager,
+            primaryKey: Model.schema.primaryKey
         )
+        baseService.columnOrder = ZyraColumnOrder(Model.schema.fieldConfig.allFields)
     }
     
     /// Initialize with explicit table name override
@@ -601,37 +1514,211 @@ public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
             tableName: tableName,
             userId: userId,
             database: database,
-            encryptionManager: encryptionManager
+            encryptionManager: encryptionManager,
+            primaryKey: Model.schema.primaryKey
         )
+        baseService.columnOrder = ZyraColumnOrder(Model.schema.fieldConfig.allFields)
+    }
+    
+    deinit {
+        watchSubscription?.cancel()
+        for continuation in snapshotContinuations.values {
+            continuation.finish()
+        }
+    }
+    
+    /// Check if watching is currently active
+    public var isWatching: Bool {
+        return watchSubscription != nil
+    }
+    
+    /// Stop watching for updates
+    public func stopWatching() {
+        watchSubscription?.cancel()
+        watchSubscription = nil
+        watchReadiness?.supersede()
+        watchReadiness = nil
+    }
+    
+    // MARK: - Write-Behind
+    
+    /// Coalesce `updateRecord` calls per record (see `ZyraSync.writeBehind`)
+    /// Typed models are decoded from the database, so they show the new values once they are flushed
+    public var writeBehind: ZyraWriteBehind? {
+        get { baseService.writeBehind }
+        set { baseService.writeBehind = newValue }
+    }
+    
+    /// Write every pending write-behind update now
+    public func flushPendingWrites() async throws {
+        try await baseService.flushPendingWrites()
+    }
+    
+    // MARK: - Live Snapshots
+    
+    /// Stream of typed snapshots, one per watch emission that changed something
+    /// The watch stays live after `loadRecords`, so screens can follow this instead of reloading to refresh.
+    /// Only rows whose values changed are rebuilt per emission; `changes` names them by primary key.
+    /// A consumer that subscribes after the first snapshot starts with a reset of the current `records`;
+    /// every snapshot is delivered (unbounded buffer) after `records` has been updated
+    public func snapshots() -> AsyncStream<ZyraModelSnapshot<Model>> {
+        return AsyncStream { continuation in
+            let id = UUID()
+            snapshotContinuations[id] = continuation
+            if watchReadiness?.timeToFirstRow != nil {
+                continuation.yield(ZyraModelSnapshot(models: records, changes: ZyraChangeSet(resetIds: recordIds)))
+            }
+            continuation.onTermination = { [weak self] _ in
+                Task { @MainActor in
+                    self?.snapshotContinuations[id] = nil
+                }
+            }
+        }
+    }
+    
+    /// Stream of keyed change sets only (see `snapshots()`)
+    public func changeStream() -> AsyncMapSequence<AsyncStream<ZyraModelSnapshot<Model>>, ZyraChangeSet> {
+        return snapshots().map { $0.changes }
+    }
+    
+    private func publish(_ models: [Model], changes: ZyraChangeSet, ids: [String]) {
+        records = models
+        recordIds = ids
+        let snapshot = ZyraModelSnapshot(models: models, changes: changes)
+        for continuation in snapshotContinuations.values {
+            continuation.yield(snapshot)
+        }
     }
     
     /// Load records as typed models
+    /// Decoded rows become `Model`s with `init(row:)` (no `[String: Any]` in between);
+    /// rows whose values did not change keep their previous model
+    /// Returns once the first snapshot has been published
+    /// - Parameters:
+    ///   - fields: Columns to read (nil = the schema's `listProjection`; columns left out decode as their
+    ///     fallback values until `detailed(_:)` loads them, and updates from listed models leave them alone)
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
     public func loadRecords(
         fields: [String]? = nil,
         whereClause: String? = nil,
         parameters: [Any] = [],
-        orderBy: String? = nil
+        orderBy: String? = nil,
+        timeout: TimeInterval? = nil
     ) async throws {
         let schema = Model.schema
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         
-        let fieldsToLoad = fields ?? config.allFields
+        let fieldsToLoad = fields ?? schema.listProjection
         let orderByClause = orderBy ?? config.defaultOrderBy
         
-        try await baseService.loadRecords(
-            fields: fieldsToLoad,
-            whereClause: whereClause,
-            parameters: parameters,
-            orderBy: orderByClause,
-            encryptedFields: config.encryptedFields,
-            integerFields: config.integerFields,
-            booleanFields: config.booleanFields
-        )
+        var query = "SELECT \(fieldsToLoad.map { "\"\($0)\"" }.joined(separator: ", ")) FROM \"\(baseService.table)\""
+        var queryParams: [Any] = []
+        if let whereClause = whereClause, !whereClause.isEmpty {
+            query += " WHERE \(whereClause)"
+            queryParams.append(contentsOf: parameters)
+        }
+        query += " ORDER BY \(orderByClause)"
+        
+        // The plan covers every schema column in schema order, so ordinals match init(row:);
+        // when only some fields are selected the rest resolve to nil
+        let plan = Model.decodePlan(fieldsMatchSelectOrder: fieldsToLoad == config.allFields)
+        unloadedFields = fieldsToLoad.contains("*") ? [] : config.allFields.filter { !fieldsToLoad.contains($0) }
+        
+        startWatch(sql: query, parameters: queryParams, plan: plan)
+        
+        // Wait for the first snapshot to be published
+        guard let readiness = watchReadiness else { return }
+        let elapsed = try await readiness.wait(timeout: timeout)
+        ZyraFormLogger.debug("✅ Typed watch started for \(baseService.table) (first snapshot in \(String(format: "%.1f", elapsed * 1000)) ms)")
+    }
+    
+    /// Load records as typed models with a typed query (see `loadRecords(fields:whereClause:parameters:orderBy:timeout:)`)
+    /// A query without `select` loads the schema's `listProjection`
+    /// - Parameters:
+    ///   - query: Query, e.g. `Model.query().where("is_completed", equals: false)`
+    ///   - timeout: Maximum seconds to wait for the first snapshot (nil = no limit)
+    /// - Throws: `ZyraQueryError` when the query does not fit the schema
+    public func loadRecords(query: ZyraQuery, timeout: TimeInterval? = nil) async throws {
+        let schema = Model.schema
+        let query = query.projection == nil && !schema.detailFields.isEmpty ? query.select(schema.listProjection) : query
+        let compiled = try query.compile()
+        
+        // Without a projection the compiled plan is every schema column in schema order, matching init(row:);
+        // a projection is resolved by name against the full plan so the remaining ordinals read nil
+        let plan = query.projection == nil ? compiled.plan : Model.decodePlan(fieldsMatchSelectOrder: false)
+        unloadedFields = query.projection.map { projection in schema.fieldConfig.allFields.filter { !projection.contains($0) } } ?? []
+        
+        startWatch(sql: compiled.sql, parameters: try baseService.resolvingBlindValues(query.parameters), plan: plan)
+        
+        guard let readiness = watchReadiness else { return }
+        let elapsed = try await readiness.wait(timeout: timeout)
+        ZyraFormLogger.debug("✅ Typed watch started for \(baseService.table) (first snapshot in \(String(format: "%.1f", elapsed * 1000)) ms)")
+    }
+    
+    /// Join the shared watch for the query (see `ZyraWatchHub`)
+    /// Rows arrive decoded and diffed with the base service's user, keys and coalescing; models are built
+    /// on the main actor, and only for the rows the emission's change set names
+    private func startWatch(sql: String, parameters: [Any], plan: ZyraDecodePlan) {
+        let decoder = ZyraModelDecoder<Model>(primaryKey: Model.schema.primaryKey)
+        modelDecoder = decoder
+        
+        let readiness = ZyraWatchReadiness()
+        watchReadiness?.supersede()
+        watchReadiness = readiness
+        
+        let source = baseService.table
+        let previous = watchSubscription
+        watchSubscription = baseService.subscribe(sql: sql, parameters: parameters, plan: plan) { [weak self] event in
+            // Ignore emissions of a watch this instance has replaced
+            guard let self = self, self.watchReadiness === readiness else { return }
+            
+            switch event {
+            case .snapshot(let rows, let changes):
+                do {
+                    let models = try decoder.apply(rows, changes: changes)
+                    self.publish(models, changes: changes, ids: decoder.committedIds)
+                    readiness.succeed()
+                    ZyraFormLogger.debug("🔄 Typed watch updated: \(models.count) \(Model.self) records from \(source) (\(changes.inserted.count) inserted, \(changes.updated.count) updated, \(changes.removed.count) removed)")
+                } catch {
+                    // The next emission's change set is relative to this one, so rebuild every row then
+                    decoder.reset()
+                    readiness.fail(error)
+                    ZyraFormLogger.error("❌ Typed decode error for \(source): \(error.localizedDescription)")
+                }
+            case .failure(let error):
+                readiness.fail(error)
+                self.watchSubscription = nil
+                ZyraFormLogger.error("❌ Typed watch error for \(source): \(error.localizedDescription)")
+            }
+        }
+        previous?.cancel()
+    }
+    
+    // MARK: - Detail Columns
+    
+    /// The model with every column, for models loaded through a list projection
+    /// The complete row is read on first access (requests made together share one query) and the model
+    /// is memoized until the row's `updated_at` changes
+    /// - Returns: The complete model (`model` itself when the schema has no detail columns or the row no longer exists)
+    public func detailed(_ model: Model) async throws -> Model {
+        guard !Model.schema.detailFields.isEmpty, let id = model.id as? String else { return model }
+        
+        let version = modelDecoder?.version(of: id)
+        if let memoized = detailedModels[id], version == nil || memoized.version == version {
+            return memoized.model
+        }
         
-        // Convert dictionaries to typed models
-        records = try baseService.records.map { record in
-            try Model(from: record)
+        guard let row = try await detailLoader.row(id: id, version: version) else { return model }
+        
+        // Laid out in schema order, the ordinals `init(row:)` reads
+        var ordered = ZyraRow(layout: Model.schema.rowLayout)
+        for (name, value) in zip(row.layout.names, row.values) {
+            guard let ordinal = Model.schema.ordinal(of: name) else { continue }
+            ordered.set(ordinal, to: value)
         }
+        let detailed = try Model(row: ZyraModelRow(row: ordered, primaryKey: Model.schema.primaryKey))
+        detailedModels[id] = (row.string("updated_at"), detailed)
+        return detailed
     }
     
     /// Create a record from a model
@@ -641,13 +1728,57 @@ public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
         autoTimestamp: Bool = true
     ) async throws -> String {
         let schema = Model.schema
-        let config = schema.toTableFieldConfig()
+        let config = schema.fieldConfig
         
         var dict = model.toDictionary()
         
         return try await baseService.createRecord(
             fields: dict,
             encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoGenerateId: autoGenerateId,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Create a record from a model, or update the record with its id when one exists (see `ZyraSync.upsertRecords`)
+    /// - Returns: The record's id
+    public func upsertRecord(
+        _ model: Model,
+        autoTimestamp: Bool = true
+    ) async throws -> String {
+        return try await upsertRecords([model], autoTimestamp: autoTimestamp)[0]
+    }
+    
+    /// Create or update records from several models in one write transaction (see `ZyraSync.upsertRecords`)
+    /// - Returns: Ids of the records, in input order
+    public func upsertRecords(
+        _ models: [Model],
+        autoTimestamp: Bool = true
+    ) async throws -> [String] {
+        let config = Model.schema.fieldConfig
+        
+        return try await baseService.upsertRecords(
+            records: models.map { writableFields(of: $0) },
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Create records from several models in one write transaction (see `ZyraSync.createRecords`)
+    /// - Returns: Ids of the created records, in input order
+    public func createRecords(
+        _ models: [Model],
+        autoGenerateId: Bool = true,
+        autoTimestamp: Bool = true
+    ) async throws -> [String] {
+        let config = Model.schema.fieldConfig
+        
+        return try await baseService.createRecords(
+            records: models.map { $0.toDictionary() },
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
             autoGenerateId: autoGenerateId,
             autoTimestamp: autoTimestamp
         )
@@ -658,15 +1789,45 @@ public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
         _ model: Model,
         autoTimestamp: Bool = true
     ) async throws {
-        let schema = Model.schema
-        let config = schema.toTableFieldConfig()
-        
-        var dict = model.toDictionary(excluding: ["id", "created_at"])
+        let config = Model.schema.fieldConfig
         
         try await baseService.updateRecord(
             id: model.id as! String,
-            fields: dict,
+            fields: writableFields(of: model, excluding: ["id", "created_at"]),
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Update records from several models in one write transaction (see `ZyraSync.updateRecords(_:encryptedFields:blindIndexedFields:autoTimestamp:)`)
+    public func updateRecords(
+        _ models: [Model],
+        autoTimestamp: Bool = true
+    ) async throws {
+        let config = Model.schema.fieldConfig
+        
+        try await baseService.updateRecords(
+            models.map { (id: $0.id as! String, fields: writableFields(of: $0, excluding: ["id", "created_at"])) },
             encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
+            autoTimestamp: autoTimestamp
+        )
+    }
+    
+    /// Set the same fields on every record matching a query's filters, with one UPDATE statement
+    public func updateRecords(
+        matching query: ZyraQuery,
+        set fields: [String: Any],
+        autoTimestamp: Bool = true
+    ) async throws {
+        let config = Model.schema.fieldConfig
+        
+        try await baseService.updateRecords(
+            matching: query,
+            set: fields,
+            encryptedFields: config.encryptedFields,
+            blindIndexedFields: config.blindIndexedFields,
             autoTimestamp: autoTimestamp
         )
     }
@@ -675,4 +1836,30 @@ public class TypedZyraSync<Model: ZyraModel>: ObservableObject {
     public func deleteRecord(_ model: Model) async throws {
         try await baseService.deleteRecord(id: model.id as! String)
     }
+    
+    /// Columns of `model` to write
+    /// A model from a list watch holds fallback values for the columns the watch did not read; those columns
+    /// are left out unless the model's value differs from the listed one, so an update never overwrites
+    /// detail columns `detailed(_:)` has not loaded
+    private func writableFields(of model: Model, excluding columns: [String] = []) -> [String: Any] {
+        var fields = model.toDictionary(excluding: columns)
+        guard !unloadedFields.isEmpty,
+              let id = model.id as? String,
+              let listed = modelDecoder?.model(for: id)?.toDictionary(excluding: columns) else {
+            return fields
+        }
+        
+        for field in unloadedFields where TypedZyraSync.isSameValue(fields[field], listed[field]) {
+            fields[field] = nil
+        }
+        return fields
+    }
+    
+    private static func isSameValue(_ lhs: Any?, _ rhs: Any?) -> Bool {
+        if let left = ZyraValue(lhs), let right = ZyraValue(rhs) {
+            return left == right
+        }
+        // Optionals boxed in `Any` and values without a column representation
+        return String(describing: lhs) == String(describing: rhs)
+    }
 }
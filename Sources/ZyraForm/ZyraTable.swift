@@ -32,6 +32,54 @@ public struct TableFieldConfig {
     public let integerFields: [String]
     public let booleanFields: [String]
     public let defaultOrderBy: String
+    /// Encrypted fields with a blind-index companion column (see `ColumnBuilder.blindIndexed()`)
+    public let blindIndexedFields: [String]
+    
+    /// Membership sets for per-field checks
+    public let encryptedFieldSet: Set<String>
+    public let integerFieldSet: Set<String>
+    public let booleanFieldSet: Set<String>
+    public let blindIndexedFieldSet: Set<String>
+    
+    public init(
+        allFields: [String],
+        encryptedFields: [String],
+        integerFields: [String],
+        booleanFields: [String],
+        defaultOrderBy: String,
+        blindIndexedFields: [String] = []
+    ) {
+        self.allFields = allFields
+        self.encryptedFields = encryptedFields
+        self.integerFields = integerFields
+        self.booleanFields = booleanFields
+        self.defaultOrderBy = defaultOrderBy
+        self.blindIndexedFields = blindIndexedFields
+        self.encryptedFieldSet = Set(encryptedFields)
+        self.integerFieldSet = Set(integerFields)
+        self.booleanFieldSet = Set(booleanFields)
+        self.blindIndexedFieldSet = Set(blindIndexedFields)
+    }
+    
+    /// Whether the field is stored encrypted
+    public func isEncrypted(_ field: String) -> Bool {
+        return encryptedFieldSet.contains(field)
+    }
+    
+    /// Whether the field is an integer column
+    public func isInteger(_ field: String) -> Bool {
+        return integerFieldSet.contains(field)
+    }
+    
+    /// Whether the field is a boolean column
+    public func isBoolean(_ field: String) -> Bool {
+        return booleanFieldSet.contains(field)
+    }
+    
+    /// Whether equality on the field is answered by its blind-index column
+    public func isBlindIndexed(_ field: String) -> Bool {
+        return blindIndexedFieldSet.contains(field)
+    }
 }
 
 /// Metadata for a PowerSync column
@@ -121,6 +169,12 @@ public struct ColumnMetadata {
     public let ipv4Error: String?
     public let ipv6Error: String?
     
+    /// Indexed in the table's local full-text search index (see `ColumnBuilder.searchable()`)
+    public let isSearchable: Bool
+    
+    /// Has a blind-index companion column for equality lookups (see `ColumnBuilder.blindIndexed()`)
+    public let isBlindIndexed: Bool
+    
     public indirect enum SwiftColumnType: Equatable {
         case string
         case integer
@@ -375,6 +429,8 @@ public struct ColumnBuilder {
     public var lowercaseError: String? = nil
     public var ipv4Error: String? = nil
     public var ipv6Error: String? = nil
+    public var isSearchable: Bool = false
+    public var isBlindIndexed: Bool = false
     
     // Use indirect reference to break circular dependency
     private var _nestedSchema: NestedSchema?
@@ -432,6 +488,36 @@ public struct ColumnBuilder {
         return builder
     }
     
+    /// Index this column in the table's local FTS5 full-text search index
+    /// Install the index with `ZyraSchema.installSearchIndexes(on:)` and query it with `SchemaBasedSync.search(_:)`.
+    /// Encrypted columns cannot be searched (the database only holds their ciphertext) and are left out
+    /// - Returns: ColumnBuilder with searchable flag set
+    /// - Example:
+    ///   ```swift
+    ///   zf.text("title").searchable().notNull()
+    ///   ```
+    public func searchable() -> ColumnBuilder {
+        var builder = self
+        builder.isSearchable = true
+        return builder
+    }
+    
+    /// Allow equality lookups on this encrypted column through a blind index
+    /// The table gets a companion column `<name>_bidx` holding a keyed HMAC of the normalized plaintext
+    /// (trimmed, Unicode-normalized, lowercased), plus an index on it. Writes through `ZyraSync` fill it,
+    /// and `ZyraQuery` equality and IN filters on the column become indexed lookups on the token.
+    /// Equal plaintexts share a token, so only use it where revealing equality is acceptable
+    /// - Returns: ColumnBuilder with blind-index flag set
+    /// - Example:
+    ///   ```swift
+    ///   zf.text("email").encrypted().blindIndexed().notNull()
+    ///   ```
+    public func blindIndexed() -> ColumnBuilder {
+        var builder = self
+        builder.isBlindIndexed = true
+        return builder
+    }
+    
     public func int() -> ColumnBuilder {
         var builder = self
         builder.swiftType = .integer
@@ -1049,7 +1135,9 @@ public struct ColumnBuilder {
             uppercaseError: uppercaseError,
             lowercaseError: lowercaseError,
             ipv4Error: ipv4Error,
-            ipv6Error: ipv6Error
+            ipv6Error: ipv6Error,
+            isSearchable: isSearchable,
+            isBlindIndexed: isBlindIndexed
         )
     }
 }
@@ -2126,11 +2214,39 @@ public struct ZyraTable: Hashable {
     public let name: String
     public let powerSyncTable: PowerSync.Table
     public let columns: [ColumnMetadata]
+    
+    /// Blind-index token columns (see `ColumnBuilder.blindIndexed()`)
+    /// Part of the stored table (PowerSync schema and generated DDL) but not of `columns`,
+    /// so field lists, loads, forms and generated models never see them
+    public let blindIndexColumns: [ColumnMetadata]
+    
     public let primaryKey: String
     public let defaultOrderBy: String
     public let rlsPolicies: [RLSPolicy]
     public let indexes: [PowerSync.Index]
     
+    /// Column ordinal by name, built once; the first column wins on duplicate names
+    public let columnIndex: [String: Int]
+    
+    /// Field configuration, built once (see `toTableFieldConfig()`)
+    public let fieldConfig: TableFieldConfig
+    
+    /// Column layout shared by every `SchemaRecord` built from a dictionary for this table
+    public let rowLayout: ZyraRowLayout
+    
+    /// Compiled `ZyraQuery` shapes for this table
+    public let queryCache = ZyraQueryCache()
+    
+    /// Columns list screens load and watch, in schema order (every column when no list fields were declared)
+    /// Always includes the primary key, `updated_at` and the `defaultOrderBy` sort column
+    public let listProjection: [String]
+    
+    /// Columns outside `listProjection`, fetched on demand by `ZyraDetailLoader`
+    public let detailFields: [String]
+    
+    /// Columns indexed for full-text search, in schema order (searchable columns that are not encrypted; `id` keys the index)
+    public let searchableFields: [String]
+    
     // Store original column builders for many-to-many relationship detection
     private let originalColumnBuilders: [ColumnBuilder]
     
@@ -2144,19 +2260,21 @@ public struct ZyraTable: Hashable {
     
     /// Initialize with fluent API
     /// Automatically adds: id (primary key), created_at, updated_at columns
+    /// - Parameter listFields: Columns shown on list screens; the others (typically heavy or encrypted ones)
+    ///   are left out of list watches and loaded per record on demand (nil = list screens load every column)
     public init(
         name: String,
         primaryKey: String = "id",
         defaultOrderBy: String = "created_at DESC",
         columns: [ColumnBuilder],
         indexes: [PowerSync.Index] = [],
-        rlsPolicies: [RLSPolicy] = []
+        rlsPolicies: [RLSPolicy] = [],
+        listFields: [String]? = nil
     ) {
         self.name = name
         self.primaryKey = primaryKey
         self.defaultOrderBy = defaultOrderBy
         self.rlsPolicies = rlsPolicies
-        self.indexes = indexes
         self.originalColumnBuilders = columns
         
         // Build metadata for all columns
@@ -2191,20 +2309,85 @@ public struct ZyraTable: Hashable {
             allColumns.append(updatedAtColumn)
         }
         
+        // Add a token column and its index for each blind-indexed encrypted column
+        var allIndexes = indexes
+        var tokenColumns: [ColumnMetadata] = []
+        for column in allColumns where column.isBlindIndexed {
+            guard column.isEncrypted else {
+                ZyraFormLogger.warning("⚠️ \(name).\(column.name) is not encrypted; blindIndexed() has no effect")
+                continue
+            }
+            let tokenColumn = ZyraTable.blindIndexColumn(for: column.name)
+            if !allColumns.contains(where: { $0.name == tokenColumn }) && !tokenColumns.contains(where: { $0.name == tokenColumn }) {
+                tokenColumns.append(
+                    ColumnBuilder(name: tokenColumn, powerSyncColumn: .text(tokenColumn))
+                        .nullable()
+                        .build()
+                )
+            }
+            let indexName = "\(name)_\(tokenColumn)"
+            if !allIndexes.contains(where: { $0.name == indexName }) {
+                allIndexes.append(.ascending(name: indexName, column: tokenColumn))
+            }
+        }
+        self.indexes = allIndexes
+        
         self.columns = allColumns
+        self.blindIndexColumns = tokenColumns
+        
+        var columnIndex = [String: Int](minimumCapacity: allColumns.count)
+        for (ordinal, column) in allColumns.enumerated() where columnIndex[column.name] == nil {
+            columnIndex[column.name] = ordinal
+        }
+        self.columnIndex = columnIndex
+        self.rowLayout = ZyraRowLayout(names: allColumns.map { $0.name })
+        self.fieldConfig = TableFieldConfig(
+            allFields: allColumns.map { $0.name },
+            encryptedFields: allColumns.filter { $0.isEncrypted }.map { $0.name },
+            integerFields: allColumns.filter { $0.swiftType == .integer }.map { $0.name },
+            booleanFields: allColumns.filter { $0.swiftType == .bool }.map { $0.name },
+            defaultOrderBy: defaultOrderBy,
+            blindIndexedFields: allColumns.filter { $0.isBlindIndexed && $0.isEncrypted }.map { $0.name }
+        )
+        
+        let allFields = allColumns.map { $0.name }
+        if let listFields = listFields {
+            var listed = Set(listFields)
+            listed.insert(primaryKey)
+            listed.insert("updated_at")
+            if let sortColumn = ZyraTable.sortTerm(of: defaultOrderBy)?.column {
+                listed.insert(sortColumn)
+            }
+            self.listProjection = allFields.filter { listed.contains($0) }
+            self.detailFields = allFields.filter { !listed.contains($0) }
+        } else {
+            self.listProjection = allFields
+            self.detailFields = []
+        }
+        
+        for column in allColumns where column.isSearchable && column.isEncrypted {
+            ZyraFormLogger.warning("⚠️ \(name).\(column.name) is encrypted and cannot be indexed for search")
+        }
+        self.searchableFields = allColumns.filter { $0.isSearchable && !$0.isEncrypted && $0.name != "id" }.map { $0.name }
         
         // Create PowerSync table from columns, excluding the id column
         // PowerSync automatically adds id column, so we shouldn't include it
-        let powerSyncColumns = self.columns
+        // Blind-index token columns are stored locally too
+        let powerSyncColumns = (allColumns + tokenColumns)
             .filter { $0.name.lowercased() != primaryKey.lowercased() }
             .map { $0.powerSyncColumn }
         self.powerSyncTable = PowerSync.Table(
             name: name,
             columns: powerSyncColumns,
-            indexes: indexes
+            indexes: allIndexes
         )
     }
     
+    /// Columns as stored: `columns` followed by the blind-index token columns
+    public var storedColumns: [ColumnMetadata] {
+        return blindIndexColumns.isEmpty ? columns : columns + blindIndexColumns
+    }
+    
     /// Get original column builders (for many-to-many relationship detection)
     internal func getOriginalColumnBuilders() -> [ColumnBuilder] {
         return originalColumnBuilders
@@ -2233,28 +2416,36 @@ public struct ZyraTable: Hashable {
     }
     
     /// Generate TableFieldConfig automatically
+    /// Built once when the table is created; this returns the cached `fieldConfig`
     public func toTableFieldConfig() -> TableFieldConfig {
-        let allFields = columns.map { $0.name }
-        
-        let encryptedFields = columns
-            .filter { $0.isEncrypted }
-            .map { $0.name }
-        
-        let integerFields = columns
-            .filter { $0.swiftType == .integer }
-            .map { $0.name }
-        
-        let booleanFields = columns
-            .filter { $0.swiftType == .bool }
-            .map { $0.name }
-        
-        return TableFieldConfig(
-            allFields: allFields,
-            encryptedFields: encryptedFields,
-            integerFields: integerFields,
-            booleanFields: booleanFields,
-            defaultOrderBy: defaultOrderBy
-        )
+        return fieldConfig
+    }
+    
+    /// Ordinal of the named column, O(1)
+    public func ordinal(of field: String) -> Int? {
+        return columnIndex[field]
+    }
+    
+    /// Metadata of the named column, O(1)
+    public func column(named field: String) -> ColumnMetadata? {
+        guard let ordinal = columnIndex[field] else { return nil }
+        return columns[ordinal]
+    }
+    
+    /// Whether list screens load `field` (false = it is fetched on demand)
+    public func isListed(_ field: String) -> Bool {
+        return detailFields.isEmpty || !detailFields.contains(field)
+    }
+    
+    /// Column and direction of the first term of an ORDER BY clause, e.g. `created_at DESC`
+    static func sortTerm(of orderBy: String) -> (column: String, ascending: Bool)? {
+        let term = orderBy.split(separator: ",").first.map(String.init) ?? ""
+        let words = term.split(whereSeparator: { $0.isWhitespace })
+        guard let name = words.first.map({ $0.replacingOccurrences(of: "\"", with: "") }), !name.isEmpty else {
+            return nil
+        }
+        let ascending = words.count < 2 || words[1].uppercased() != "DESC"
+        return (name, ascending)
     }
     
     /// Create a filtered version of this table with only specified fields
@@ -2276,6 +2467,8 @@ public struct ZyraTable: Hashable {
             builder.intMax = column.intMax
             builder.isEmail = column.isEmail
             builder.isUrl = column.isUrl
+            builder.isSearchable = column.isSearchable
+            builder.isBlindIndexed = column.isBlindIndexed
             // Add other properties as needed
             return builder
         }
@@ -2286,7 +2479,8 @@ public struct ZyraTable: Hashable {
             defaultOrderBy: defaultOrderBy,
             columns: columnBuilders,
             indexes: indexes,
-            rlsPolicies: rlsPolicies
+            rlsPolicies: rlsPolicies,
+            listFields: detailFields.isEmpty ? nil : listProjection.filter { fields.contains($0) }
         )
     }
     
@@ -2372,7 +2566,7 @@ public struct ZyraTable: Hashable {
         columnDefinitions.append("\(primaryKey) TEXT PRIMARY KEY")
         
         // Add each column with its definition (skip primary key since already added)
-        for column in columns {
+        for column in storedColumns {
             // Skip primary key column since it's already added above
             if column.name.lowercased() == primaryKey.lowercased() {
                 continue
@@ -2593,7 +2787,7 @@ public struct ZyraTable: Hashable {
         columnDefinitions.append("\(primaryKey) TEXT PRIMARY KEY")
         
         // Add each column with its definition (skip primary key since already added)
-        for column in columns {
+        for column in storedColumns {
             // Skip primary key column since it's already added above
             if column.name.lowercased() == primaryKey.lowercased() {
                 continue
@@ -2944,7 +3138,7 @@ public struct ZyraTable: Hashable {
         columnDefinitions.append("\(primaryKey) TEXT PRIMARY KEY")
         
         // Add each column with its definition (skip primary key since already added)
-        for column in columns {
+        for column in storedColumns {
             // Skip primary key column since it's already added above
             if column.name.lowercased() == primaryKey.lowercased() {
                 continue
@@ -3035,7 +3229,7 @@ public struct ZyraTable: Hashable {
         }
         
         // Add each column with its definition (skip primary key since already added)
-        for column in columns {
+        for column in storedColumns {
             // Skip primary key column since it's already added above
             if column.name.lowercased() == primaryKey.lowercased() {
                 continue
@@ -3167,7 +3361,7 @@ public struct ZyraTable: Hashable {
         }
         
         // Add each column with its definition (skip primary key since already added)
-        for column in columns {
+        for column in storedColumns {
             // Skip primary key column since it's already added above
             if column.name.lowercased() == primaryKey.lowercased() {
                 continue
@@ -3551,9 +3745,10 @@ public struct ZyraTable: Hashable {
         var properties: [String] = []
         var codingKeys: [String] = []
         var initStatements: [String] = []
+        var rowInitStatements: [String] = []
         var toDictStatements: [String] = []
         
-        for column in columns {
+        for (ordinal, column) in columns.enumerated() {
             let swiftName = toCamelCase(column.name)
             // Use Date for date types, otherwise use the standard Swift type
             let swiftType: String
@@ -3577,6 +3772,9 @@ public struct ZyraTable: Hashable {
             let initLine = generateInitLine(for: column, swiftName: swiftName, swiftType: swiftType)
             initStatements.append(initLine)
             
+            // Init from cursor row (ordinal = schema column position)
+            rowInitStatements.append(generateRowInitLine(for: column, ordinal: ordinal, swiftName: swiftName, swiftType: swiftType))
+            
             // toDictionary
             let dictLine = generateToDictLine(for: column, swiftName: swiftName)
             toDictStatements.append(dictLine)
@@ -3598,11 +3796,7 @@ public struct ZyraTable: Hashable {
                 var enumCode = "\n    enum \(enumName): String, Codable {\n"
                 var enumCases: [String] = []
                 for value in enumType.values {
-                    let caseName = value
-                        .replacingOccurrences(of: "-", with: "_")
-                        .replacingOccurrences(of: " ", with: "_")
-                        .replacingOccurrences(of: ".", with: "_")
-                    enumCases.append("        case \(caseName) = \"\(value)\"")
+                    enumCases.append("        case \(enumCaseName(value)) = \"\(value)\"")
                 }
                 enumCode += enumCases.joined(separator: "\n")
                 enumCode += "\n    }"
@@ -3627,6 +3821,12 @@ public struct ZyraTable: Hashable {
         code += initStatements.joined(separator: "\n")
         code += "\n    }\n\n"
         
+        // Generate init(row:)
+        code += "    // Initialize straight from a cursor row (columns by schema ordinal)\n"
+        code += "    init(row: ZyraModelRow) throws {\n"
+        code += rowInitStatements.joined(separator: "\n")
+        code += "\n    }\n\n"
+        
         // Generate toDictionary
         code += "    // Convert to dictionary for saving\n"
         code += "    func toDictionary(excluding columns: [String] = []) -> [String: Any] {\n"
@@ -3704,7 +3904,7 @@ public struct ZyraTable: Hashable {
                     if let dateValue = record["\(columnName)"] as? Date {
                         return dateValue
                     } else if let strValue = record["\(columnName)"] as? String {
-                        return ISO8601DateFormatter().date(from: strValue)
+                        return ZyraTimestamp.date(from: strValue)
                     }
                     return nil
                 }()
@@ -3715,7 +3915,7 @@ public struct ZyraTable: Hashable {
                     if let dateValue = record["\(columnName)"] as? Date {
                         return dateValue
                     } else if let strValue = record["\(columnName)"] as? String {
-                        return ISO8601DateFormatter().date(from: strValue) ?? Date()
+                        return ZyraTimestamp.date(from: strValue) ?? Date()
                     }
                     return Date()
                 }()
@@ -3733,6 +3933,56 @@ public struct ZyraTable: Hashable {
         return line
     }
     
+    /// Generate `init(row:)` line for a column, reading it by schema ordinal
+    private func generateRowInitLine(for column: ColumnMetadata, ordinal: Int, swiftName: String, swiftType: String) -> String {
+        let accessor: String
+        let fallback: String?
+        
+        switch column.swiftType {
+        case .bool:
+            accessor = "row.bool(\(ordinal))"
+            fallback = column.defaultValue?.lowercased() == "true" ? "true" : "false"
+        case .integer:
+            accessor = "row.int(\(ordinal))"
+            fallback = column.isNullable ? nil : (column.defaultValue ?? "0")
+        case .bigInt:
+            accessor = "row.int64(\(ordinal))"
+            fallback = column.isNullable ? nil : (column.defaultValue ?? "0")
+        case .double:
+            accessor = "row.double(\(ordinal))"
+            fallback = column.isNullable ? nil : (column.defaultValue ?? "0.0")
+        case .decimal:
+            accessor = "row.decimal(\(ordinal))"
+            fallback = column.isNullable ? nil : (column.defaultValue.map { "Decimal(string: \"\($0)\") ?? 0" } ?? "0")
+        case .date:
+            accessor = "row.date(\(ordinal))"
+            fallback = column.isNullable ? nil : "Date()"
+        case .enum:
+            let enumName = swiftType.hasSuffix("?") ? String(swiftType.dropLast()) : swiftType
+            accessor = "row.string(\(ordinal)).flatMap { \(enumName)(rawValue: $0) }"
+            // The default case when it names one, otherwise the first case of the enum
+            let values = column.enumType?.values ?? []
+            let fallbackValue = column.defaultValue.flatMap { values.contains($0) ? $0 : nil } ?? values.first
+            fallback = column.isNullable ? nil : fallbackValue.map { ".\(enumCaseName($0))" }
+        default:
+            accessor = "row.string(\(ordinal))"
+            fallback = column.isNullable ? nil : (column.defaultValue ?? (swiftType == "String" ? "\"\"" : "nil"))
+        }
+        
+        if let fallback = fallback {
+            return "        self.\(swiftName) = \(accessor) ?? \(fallback)"
+        }
+        return "        self.\(swiftName) = \(accessor)"
+    }
+    
+    /// Swift case name generated for an enum value
+    private func enumCaseName(_ value: String) -> String {
+        return value
+            .replacingOccurrences(of: "-", with: "_")
+            .replacingOccurrences(of: " ", with: "_")
+            .replacingOccurrences(of: ".", with: "_")
+    }
+    
     /// Generate toDictionary line for a column
     private func generateToDictLine(for column: ColumnMetadata, swiftName: String) -> String {
         let columnName = column.name
@@ -3742,9 +3992,9 @@ public struct ZyraTable: Hashable {
             return "            \"\(columnName)\": \(swiftName) ? \"true\" : \"false\""
         case .date:
             if column.isNullable {
-                return "            \"\(columnName)\": \(swiftName) != nil ? ISO8601DateFormatter().string(from: \(swiftName)!) : nil"
+                return "            \"\(columnName)\": \(swiftName) != nil ? ZyraTimestamp.string(from: \(swiftName)!) : nil"
             } else {
-                return "            \"\(columnName)\": ISO8601DateFormatter().string(from: \(swiftName))"
+                return "            \"\(columnName)\": ZyraTimestamp.string(from: \(swiftName))"
             }
         default:
             return "            \"\(columnName)\": \(swiftName)"
@@ -3789,7 +4039,7 @@ public struct ZyraTable: Hashable {
         // Generate column definitions
         var drizzleColumns: [String] = []
         
-        for column in columns {
+        for column in storedColumns {
             // Handle nested schemas with flattened strategy
             if let nestedSchema = column.nestedSchema,
                case .flattened(let prefix) = nestedSchema.strategy {
@@ -4471,7 +4721,7 @@ public struct ZyraTable: Hashable {
         // Generate fields
         var fields: [String] = []
         
-        for column in columns {
+        for column in storedColumns {
             // Handle nested schemas
             if let nestedSchema = column.nestedSchema {
                 switch nestedSchema.strategy {
@@ -5094,7 +5344,8 @@ public struct ZyraSchema {
                     defaultOrderBy: table.defaultOrderBy,
                     columns: updatedColumns,
                     indexes: table.indexes,
-                    rlsPolicies: table.rlsPolicies
+                    rlsPolicies: table.rlsPolicies,
+                    listFields: table.detailFields.isEmpty ? nil : table.listProjection
                 )
                 processedTables[index] = newTable
                 tableMap[table.name] = newTable
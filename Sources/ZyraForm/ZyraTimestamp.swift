@@ -0,0 +1,199 @@
+//
+//  ZyraTimestamp.swift
+//  ZyraForm
+//
+//  Fixed-format UTC ISO 8601 timestamp encoding and decoding
+//
+
+import Foundation
+
+/// ISO 8601 timestamps without a Foundation formatter
+/// Writes `yyyy-MM-dd'T'HH:mm:ss'Z'` (what `ISO8601DateFormatter()` writes) straight into the
+/// string's storage, and reads the timestamp shapes the library and Postgres produce:
+/// `T` or space separator, optional fractional seconds, and `Z`, `±HH`, `±HHMM` or `±HH:MM` offsets
+/// (no offset = UTC). Pure functions over the UTF-8 bytes, so safe from any thread
+public enum ZyraTimestamp {
+    /// Fallback for years outside 0000-9999, which the fixed format cannot represent
+    private static let fallbackFormatter = ISO8601DateFormatter()
+
+    /// Current time as a timestamp
+    public static func now() -> String {
+        return string(from: Date())
+    }
+
+    // MARK: - Encoding
+
+    /// Format `date` as `yyyy-MM-dd'T'HH:mm:ss'Z'` in UTC (fractional seconds are truncated)
+    public static func string(from date: Date) -> String {
+        let seconds = Int(floor(date.timeIntervalSince1970))
+        let days = floorDivide(seconds, 86_400)
+        let secondOfDay = seconds - days * 86_400
+        let (year, month, day) = civil(fromDays: days)
+
+        guard (0...9999).contains(year) else {
+            return fallbackFormatter.string(from: date)
+        }
+
+        let hour = secondOfDay / 3600
+        let minute = secondOfDay % 3600 / 60
+        let second = secondOfDay % 60
+
+        return String(unsafeUninitializedCapacity: 20) { buffer in
+            func put(_ value: Int, width: Int, at offset: Int) {
+                var value = value
+                for position in stride(from: offset + width - 1, through: offset, by: -1) {
+                    buffer[position] = UInt8(truncatingIfNeeded: 48 + value % 10)
+                    value /= 10
+                }
+            }
+
+            put(year, width: 4, at: 0)
+            buffer[4] = UInt8(ascii: "-")
+            put(month, width: 2, at: 5)
+            buffer[7] = UInt8(ascii: "-")
+            put(day, width: 2, at: 8)
+            buffer[10] = UInt8(ascii: "T")
+            put(hour, width: 2, at: 11)
+            buffer[13] = UInt8(ascii: ":")
+            put(minute, width: 2, at: 14)
+            buffer[16] = UInt8(ascii: ":")
+            put(second, width: 2, at: 17)
+            buffer[19] = UInt8(ascii: "Z")
+            return 20
+        }
+    }
+
+    // MARK: - Decoding
+
+    /// Parse an ISO 8601 timestamp; nil when it is not one of the accepted shapes or out of range
+    public static func date(from string: String) -> Date? {
+        var string = string
+        string.makeContiguousUTF8()
+        return string.utf8.withContiguousStorageIfAvailable { parse($0) } ?? nil
+    }
+
+    private static func parse(_ bytes: UnsafeBufferPointer<UInt8>) -> Date? {
+        let count = bytes.count
+        guard count >= 19 else { return nil }
+
+        func number(_ offset: Int, _ width: Int) -> Int? {
+            var value = 0
+            for position in offset..<(offset + width) {
+                let digit = Int(bytes[position]) - 48
+                guard (0...9).contains(digit) else { return nil }
+                value = value * 10 + digit
+            }
+            return value
+        }
+
+        guard let year = number(0, 4), bytes[4] == UInt8(ascii: "-"),
+              let month = number(5, 2), bytes[7] == UInt8(ascii: "-"),
+              let day = number(8, 2),
+              bytes[10] == UInt8(ascii: "T") || bytes[10] == UInt8(ascii: " "),
+              let hour = number(11, 2), bytes[13] == UInt8(ascii: ":"),
+              let minute = number(14, 2), bytes[16] == UInt8(ascii: ":"),
+              let second = number(17, 2) else {
+            return nil
+        }
+
+        guard (1...12).contains(month),
+              (1...daysInMonth(month, year: year)).contains(day),
+              hour < 24, minute < 60, second < 60 else {
+            return nil
+        }
+
+        var position = 19
+
+        // Fractional seconds: up to nanoseconds are kept, further digits are skipped
+        var fraction = 0.0
+        if position < count, bytes[position] == UInt8(ascii: ".") {
+            position += 1
+            var digits = 0
+            var value = 0
+            var scale = 1
+            while position < count, (48...57).contains(bytes[position]) {
+                if digits < 9 {
+                    value = value * 10 + Int(bytes[position]) - 48
+                    scale *= 10
+                }
+                digits += 1
+                position += 1
+            }
+            guard digits > 0 else { return nil }
+            fraction = Double(value) / Double(scale)
+        }
+
+        // Offset from UTC, in seconds
+        var offset = 0
+        if position < count {
+            let sign = bytes[position]
+            if sign == UInt8(ascii: "Z") || sign == UInt8(ascii: "z") {
+                position += 1
+            } else if sign == UInt8(ascii: "+") || sign == UInt8(ascii: "-") {
+                guard position + 3 <= count, let offsetHours = number(position + 1, 2) else { return nil }
+                position += 3
+                var offsetMinutes = 0
+                if position < count {
+                    if bytes[position] == UInt8(ascii: ":") {
+                        position += 1
+                    }
+                    guard position + 2 <= count, let minutes = number(position, 2) else { return nil }
+                    offsetMinutes = minutes
+                    position += 2
+                }
+                guard offsetHours < 24, offsetMinutes < 60 else { return nil }
+                offset = (offsetHours * 3600 + offsetMinutes * 60) * (sign == UInt8(ascii: "-") ? -1 : 1)
+            } else {
+                return nil
+            }
+        }
+        guard position == count else { return nil }
+
+        let days = daysFromCivil(year: year, month: month, day: day)
+        let seconds = days * 86_400 + hour * 3600 + minute * 60 + second - offset
+        return Date(timeIntervalSince1970: Double(seconds) + fraction)
+    }
+
+    // MARK: - Calendar Arithmetic
+
+    /// Days since 1970-01-01 for a proleptic Gregorian date
+    private static func daysFromCivil(year: Int, month: Int, day: Int) -> Int {
+        let year = month <= 2 ? year - 1 : year
+        let era = floorDivide(year, 400)
+        let yearOfEra = year - era * 400
+        let dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1
+        let dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear
+        return era * 146_097 + dayOfEra - 719_468
+    }
+
+    /// Proleptic Gregorian date for days since 1970-01-01
+    private static func civil(fromDays days: Int) -> (year: Int, month: Int, day: Int) {
+        let shifted = days + 719_468
+        let era = floorDivide(shifted, 146_097)
+        let dayOfEra = shifted - era * 146_097
+        let yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36_524 - dayOfEra / 146_096) / 365
+        let dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100)
+        let shiftedMonth = (5 * dayOfYear + 2) / 153
+        let day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1
+        let month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9
+        let year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0)
+        return (year, month, day)
+    }
+
+    private static func daysInMonth(_ month: Int, year: Int) -> Int {
+        switch month {
+        case 2:
+            let isLeap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0
+            return isLeap ? 29 : 28
+        case 4, 6, 9, 11:
+            return 30
+        default:
+            return 31
+        }
+    }
+
+    private static func floorDivide(_ value: Int, _ divisor: Int) -> Int {
+        let quotient = value / divisor
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient
+    }
+}
@@ -0,0 +1,279 @@
+//
+//  ZyraValue.swift
+//  ZyraForm
+//
+//  Compact tagged-union row storage for decoded records
+//
+
+import Foundation
+
+// MARK: - Value
+
+/// A decoded column value
+/// Stored inline in `ZyraRow` instead of an `Any` existential box
+public enum ZyraValue: Hashable {
+    case null
+    case integer(Int)
+    case double(Double)
+    case text(String)
+    case bool(Bool)
+    case blob(Data)
+
+    /// Wrap a dictionary value; nil for types that have no column representation (e.g. `Date`)
+    public init?(_ value: Any?) {
+        guard let value = value else {
+            self = .null
+            return
+        }
+
+        switch value {
+        case is NSNull:
+            self = .null
+        case let text as String where type(of: value) == String.self:
+            self = .text(text)
+        case let flag as Bool where type(of: value) == Bool.self:
+            self = .bool(flag)
+        case let number as Int where type(of: value) == Int.self:
+            self = .integer(number)
+        case let number as Double where type(of: value) == Double.self:
+            self = .double(number)
+        case let data as Data:
+            self = .blob(data)
+        case let number as NSNumber:
+            // Bridged numbers (JSONSerialization, Objective-C) keep their boolean/floating kind
+            switch String(cString: number.objCType) {
+            case "c", "B":
+                self = .bool(number.boolValue)
+            case "f", "d":
+                self = .double(number.doubleValue)
+            default:
+                self = .integer(number.intValue)
+            }
+        case let text as String:
+            self = .text(text)
+        default:
+            return nil
+        }
+    }
+
+    /// The value as a plain Swift value (nil for null; `ZyraRow.dictionary` stores null as `NSNull`)
+    public var anyValue: Any? {
+        switch self {
+        case .null:
+            return nil
+        case .integer(let value):
+            return value
+        case .double(let value):
+            return value
+        case .text(let value):
+            return value
+        case .bool(let value):
+            return value
+        case .blob(let value):
+            return value
+        }
+    }
+
+    public var isNull: Bool {
+        if case .null = self {
+            return true
+        }
+        return false
+    }
+
+    /// Integer value (doubles are truncated, booleans are 1/0)
+    public var intValue: Int? {
+        switch self {
+        case .integer(let value):
+            return value
+        case .double(let value):
+            return Int(exactly: value.rounded(.towardZero))
+        case .bool(let value):
+            return value ? 1 : 0
+        case .text(let value):
+            return Int(value)
+        case .null, .blob:
+            return nil
+        }
+    }
+
+    /// Floating point value of a numeric column
+    public var doubleValue: Double? {
+        switch self {
+        case .integer(let value):
+            return Double(value)
+        case .double(let value):
+            return value
+        case .text(let value):
+            return Double(value)
+        case .null, .bool, .blob:
+            return nil
+        }
+    }
+
+    /// Text value, or the text form of a scalar
+    public var stringValue: String? {
+        switch self {
+        case .null, .blob:
+            return nil
+        case .text(let value):
+            return value
+        case .integer(let value):
+            return String(value)
+        case .double(let value):
+            return String(value)
+        case .bool(let value):
+            return value ? "true" : "false"
+        }
+    }
+}
+
+// MARK: - Layout
+
+/// Column names of a result set, shared by every row of it
+/// Rows store values by ordinal and resolve names through one shared layout
+public final class ZyraRowLayout: @unchecked Sendable {
+    public let names: [String]
+    private let ordinals: [String: Int]
+
+    public init(names: [String]) {
+        self.names = names
+
+        var ordinals = [String: Int](minimumCapacity: names.count)
+        for (ordinal, name) in names.enumerated() where ordinals[name] == nil {
+            ordinals[name] = ordinal
+        }
+        self.ordinals = ordinals
+    }
+
+    /// Ordinal of the named column, O(1)
+    public func ordinal(of name: String) -> Int? {
+        return ordinals[name]
+    }
+}
+
+// MARK: - Row
+
+/// A decoded record stored as a contiguous array of `ZyraValue`s indexed by column ordinal
+/// Replaces `[String: Any]` for held result sets: no per-row hash table and no existential boxes.
+/// `dictionary` is the compatibility view; values that have no `ZyraValue` representation,
+/// or keys outside the layout, are kept in a side dictionary that stays nil for decoded rows
+public struct ZyraRow: @unchecked Sendable {
+    public let layout: ZyraRowLayout
+    public private(set) var values: ContiguousArray<ZyraValue>
+    private var overflow: [String: Any]?
+
+    /// Row with every column null
+    public init(layout: ZyraRowLayout) {
+        self.layout = layout
+        self.values = ContiguousArray(repeating: .null, count: layout.names.count)
+        self.overflow = nil
+    }
+
+    /// Row from values in layout order
+    public init(layout: ZyraRowLayout, values: ContiguousArray<ZyraValue>) {
+        precondition(values.count == layout.names.count, "ZyraRow values must match the layout")
+        self.layout = layout
+        self.values = values
+        self.overflow = nil
+    }
+
+    /// Row from a record dictionary
+    public init(layout: ZyraRowLayout, dictionary: [String: Any]) {
+        self.init(layout: layout)
+        for (name, value) in dictionary {
+            set(name, to: value)
+        }
+    }
+
+    // MARK: - Access
+
+    /// Value at a column ordinal
+    public subscript(ordinal: Int) -> ZyraValue {
+        return values[ordinal]
+    }
+
+    /// Dictionary-style access by column name (nil when null or absent)
+    public subscript(name: String) -> Any? {
+        if let extra = overflow?[name] {
+            return extra
+        }
+        guard let ordinal = layout.ordinal(of: name) else { return nil }
+        return values[ordinal].anyValue
+    }
+
+    /// Value of the named column (`.null` when absent)
+    public func value(_ name: String) -> ZyraValue {
+        if let extra = overflow?[name] {
+            return ZyraValue(extra) ?? .text(String(describing: extra))
+        }
+        guard let ordinal = layout.ordinal(of: name) else { return .null }
+        return values[ordinal]
+    }
+
+    /// Text of the named column
+    public func string(_ name: String) -> String? {
+        if case .text(let text) = value(name) {
+            return text
+        }
+        return nil
+    }
+
+    /// Record dictionary view; null columns are `NSNull`, so writing a record back clears them
+    public var dictionary: [String: Any] {
+        var dict = [String: Any](minimumCapacity: values.count + (overflow?.count ?? 0))
+        for (name, value) in zip(layout.names, values) {
+            dict[name] = value.anyValue ?? NSNull()
+        }
+        if let overflow = overflow {
+            for (name, value) in overflow {
+                dict[name] = value
+            }
+        }
+        return dict
+    }
+
+    // MARK: - Mutation
+
+    /// Set a column by name; nil clears it
+    public mutating func set(_ name: String, to value: Any?) {
+        if let ordinal = layout.ordinal(of: name) {
+            if let stored = ZyraValue(value) {
+                values[ordinal] = stored
+                overflow?[name] = nil
+                return
+            }
+            values[ordinal] = .null
+        }
+
+        guard let value = value else {
+            overflow?[name] = nil
+            return
+        }
+        if overflow == nil {
+            overflow = [:]
+        }
+        overflow?[name] = value
+    }
+
+    /// Set a column by ordinal
+    public mutating func set(_ ordinal: Int, to value: ZyraValue) {
+        values[ordinal] = value
+        if overflow != nil {
+            overflow?[layout.names[ordinal]] = nil
+        }
+    }
+}
+
+extension ZyraRow: Equatable {
+    /// Rows are equal when they hold the same values under the same column names
+    public static func == (lhs: ZyraRow, rhs: ZyraRow) -> Bool {
+        guard lhs.layout === rhs.layout || lhs.layout.names == rhs.layout.names else {
+            return NSDictionary(dictionary: lhs.dictionary).isEqual(to: rhs.dictionary)
+        }
+        guard lhs.overflow == nil && rhs.overflow == nil else {
+            return NSDictionary(dictionary: lhs.dictionary).isEqual(to: rhs.dictionary)
+        }
+        return lhs.values == rhs.values
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  ZyraWatchCoalescing.swift
+//  ZyraForm
+//
+//  Coalescing and backpressure settings for watch emission bursts
+//
+
+import Foundation
+
+/// How a watch coalesces bursts of emissions (initial sync, bulk imports)
+/// PowerSync re-queries at most once per `minimumInterval` and always delivers the trailing change;
+/// snapshots arriving while the previous one is still being decoded or published replace it instead of queueing
+public struct ZyraWatchCoalescing: Hashable, Sendable {
+    /// Minimum seconds between two published snapshots
+    public var minimumInterval: TimeInterval
+
+    /// Drop snapshots that arrive while the consumer is still busy, keeping only the newest
+    public var dropsIntermediateSnapshots: Bool
+
+    /// - Parameters:
+    ///   - minimumInterval: Minimum seconds between two published snapshots (0 = no pacing beyond PowerSync's throttle)
+    ///   - dropsIntermediateSnapshots: Keep only the newest pending snapshot while the consumer is busy
+    public init(minimumInterval: TimeInterval = 0.03, dropsIntermediateSnapshots: Bool = true) {
+        self.minimumInterval = max(0, minimumInterval)
+        self.dropsIntermediateSnapshots = dropsIntermediateSnapshots
+    }
+
+    /// PowerSync's default throttle, newest-only backpressure
+    public static let `default` = ZyraWatchCoalescing()
+
+    /// Publish at most `emissionsPerSecond` snapshots per second
+    public static func maxRate(_ emissionsPerSecond: Double) -> ZyraWatchCoalescing {
+        return ZyraWatchCoalescing(minimumInterval: emissionsPerSecond > 0 ? 1 / emissionsPerSecond : 0)
+    }
+}
+
+/// Emission counters for one shared watch, updated from the watch tasks
+public final class ZyraWatchStatistics: @unchecked Sendable {
+    private let lock = NSLock()
+    private var receivedCount = 0
+    private var droppedCount = 0
+    private var publishedCount = 0
+
+    /// Snapshots received from PowerSync
+    public var received: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return receivedCount
+    }
+
+    /// Snapshots replaced by a newer one before they were decoded
+    public var dropped: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return droppedCount
+    }
+
+    /// Snapshots decoded and published to subscribers
+    public var published: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return publishedCount
+    }
+
+    func recordReceived() {
+        lock.lock()
+        receivedCount += 1
+        lock.unlock()
+    }
+
+    func recordDropped() {
+        lock.lock()
+        droppedCount += 1
+        lock.unlock()
+    }
+
+    func recordPublished() {
+        lock.lock()
+        publishedCount += 1
+        lock.unlock()
+    }
+}
@@ -0,0 +1,321 @@
+//
+//  ZyraWatchHub.swift
+//  ZyraForm
+//
+//  Shared, reference-counted PowerSync watches
+//
+
+import Foundation
+import PowerSync
+
+/// Runs one PowerSync watch per distinct query and fans its emissions out to every subscriber
+/// Queries are keyed by database instance, normalized SQL, parameters, decode plan and user,
+/// so several `ZyraSync` instances showing the same data share one watch and one decode per emission.
+/// The underlying watch is cancelled when its last subscriber leaves
+@MainActor
+public final class ZyraWatchHub {
+    public static let shared = ZyraWatchHub()
+
+    /// An emission delivered to a subscriber
+    public enum Event {
+        /// Decoded rows and their change set; the first snapshot a subscriber receives is always a reset
+        case snapshot([ZyraRow], ZyraChangeSet)
+        /// The shared watch failed; no further events follow
+        case failure(Error)
+    }
+
+    struct Key: Hashable {
+        let database: ObjectIdentifier
+        let sql: String
+        let parameters: [String]
+        let plan: ZyraDecodePlan
+        let userId: String
+        let primaryKey: String
+        let coalescing: ZyraWatchCoalescing
+    }
+
+    private final class SharedWatch {
+        let key: Key
+        /// Identifies this run of the watch, so a cancelled run cannot deliver into its replacement
+        let generation = UUID()
+        let statistics = ZyraWatchStatistics()
+        var task: Task<Void, Never>?
+        var subscribers: [UUID: (Event) -> Void] = [:]
+        /// Last published snapshot, replayed as a reset to late subscribers
+        var latest: [ZyraRow]?
+
+        init(key: Key) {
+            self.key = key
+        }
+    }
+
+    private var watches: [Key: SharedWatch] = [:]
+
+    public init() {}
+
+    /// Number of underlying PowerSync watches currently running
+    public var activeWatchCount: Int {
+        return watches.count
+    }
+
+    /// Number of subscribers across all watches
+    public var subscriberCount: Int {
+        return watches.values.reduce(0) { $0 + $1.subscribers.count }
+    }
+
+    // MARK: - Subscribing
+
+    /// Subscribe to a query, starting its watch if no other subscriber shares it
+    /// - Parameters:
+    ///   - database: Database to watch
+    ///   - sql: SELECT statement
+    ///   - parameters: Statement parameters
+    ///   - plan: Decode plan for the result rows
+    ///   - userId: User whose key decrypts per-user encrypted columns
+    ///   - primaryKey: Column keying rows in change sets
+    ///   - encryptionManager: Encryption manager used for decryption
+    ///   - decryptCache: Cache of decrypted values for the table
+    ///   - executor: Executor decoding emissions off the main actor
+    ///   - coalescing: How bursts of emissions are coalesced; part of the sharing key
+    ///   - handler: Called on the main actor for every emission that changed something
+    /// - Returns: Subscription; cancel it (or release it) to leave the watch
+    public func subscribe(
+        database: PowerSync.PowerSyncDatabaseProtocol,
+        sql: String,
+        parameters: [Any],
+        plan: ZyraDecodePlan,
+        userId: String,
+        primaryKey: String = "id",
+        encryptionManager: SecureEncryptionManager,
+        decryptCache: ZyraDecryptCache?,
+        executor: ZyraDecodeExecutor = .shared,
+        coalescing: ZyraWatchCoalescing = .default,
+        handler: @escaping (Event) -> Void
+    ) -> ZyraWatchSubscription {
+        let key = Key(
+            database: ObjectIdentifier(database as AnyObject),
+            sql: ZyraWatchHub.normalize(sql),
+            parameters: parameters.map { "\(type(of: $0)):\($0)" },
+            plan: plan,
+            userId: userId,
+            primaryKey: primaryKey,
+            coalescing: coalescing
+        )
+        let id = UUID()
+
+        if let watch = watches[key] {
+            watch.subscribers[id] = handler
+            // Bring the late subscriber up to the current snapshot
+            if let latest = watch.latest {
+                handler(.snapshot(latest, ZyraChangeSet(resetTo: latest, primaryKey: primaryKey)))
+            }
+            ZyraFormLogger.debug("🔗 Joined shared watch (\(watch.subscribers.count) subscribers)")
+            return ZyraWatchSubscription(hub: self, key: key, id: id, statistics: watch.statistics)
+        } else {
+            let watch = SharedWatch(key: key)
+            watch.subscribers[id] = handler
+            watches[key] = watch
+
+            let differ = ZyraRowDiffer(primaryKey: primaryKey)
+            let decoder = ZyraRowDecoder(
+                plan: plan,
+                userId: userId,
+                encryptionManager: encryptionManager,
+                primaryKey: primaryKey,
+                rowReuse: differ,
+                decryptCache: decryptCache
+            )
+            watch.task = startWatch(
+                key: key,
+                generation: watch.generation,
+                statistics: watch.statistics,
+                database: database,
+                sql: sql,
+                parameters: parameters,
+                decoder: decoder,
+                differ: differ,
+                executor: executor
+            )
+            return ZyraWatchSubscription(hub: self, key: key, id: id, statistics: watch.statistics)
+        }
+    }
+
+    func unsubscribe(key: Key, id: UUID) {
+        guard let watch = watches[key] else { return }
+        watch.subscribers[id] = nil
+
+        if watch.subscribers.isEmpty {
+            watch.task?.cancel()
+            watches[key] = nil
+            ZyraFormLogger.debug("⏹️ Shared watch stopped (no subscribers left)")
+        }
+    }
+
+    // MARK: - Watch Loop
+
+    /// Run the PowerSync watch whose decoding happens off the main actor
+    /// The mapper only copies raw column values out of the cursor; decryption and conversion run on
+    /// `executor` in parallel chunks, diffing runs on the watch task, and only the fan-out hops to the main actor
+    ///
+    /// Bursts are coalesced per `key.coalescing`: PowerSync re-queries at most once per interval (with a trailing
+    /// emission), a pump forwards its snapshots into a newest-only buffer so snapshots arriving while the previous
+    /// one is still being decoded or published are dropped (and counted), and publishing is paced to the interval
+    private func startWatch(
+        key: Key,
+        generation: UUID,
+        statistics: ZyraWatchStatistics,
+        database: PowerSync.PowerSyncDatabaseProtocol,
+        sql: String,
+        parameters: [Any],
+        decoder: ZyraRowDecoder,
+        differ: ZyraRowDiffer,
+        executor: ZyraDecodeExecutor
+    ) -> Task<Void, Never> {
+        let coalescing = key.coalescing
+        
+        return Task.detached(priority: .userInitiated) { [weak self] in
+            let snapshots = AsyncThrowingStream<[ZyraRawRow], Error>(
+                bufferingPolicy: coalescing.dropsIntermediateSnapshots ? .bufferingNewest(1) : .unbounded
+            ) { continuation in
+                let pump = Task {
+                    do {
+                        for try await rawRows in try database.watch(
+                            options: WatchOptions(
+                                sql: sql,
+                                parameters: parameters,
+                                throttle: coalescing.minimumInterval,
+                                mapper: { cursor in
+                                    decoder.read(cursor)
+                                }
+                            )
+                        ) {
+                            statistics.recordReceived()
+                            if case .dropped = continuation.yield(rawRows) {
+                                statistics.recordDropped()
+                            }
+                        }
+                        continuation.finish()
+                    } catch {
+                        continuation.finish(throwing: error)
+                    }
+                }
+                continuation.onTermination = { _ in
+                    pump.cancel()
+                }
+            }
+            
+            do {
+                for try await rawRows in snapshots {
+                    let startedAt = DispatchTime.now()
+                    let results = await executor.decode(rawRows, with: decoder)
+
+                    // Diff against the previous emission; skip publishing when nothing changed
+                    let changes = differ.apply(results, stored: rawRows)
+                    guard !changes.isEmpty, !Task.isCancelled else { continue }
+
+                    await self?.deliver(.snapshot(results, changes), latest: results, to: key, generation: generation)
+                    statistics.recordPublished()
+                    
+                    // Pace publishing; snapshots arriving meanwhile collapse into the newest one (trailing emission)
+                    let elapsed = TimeInterval(DispatchTime.now().uptimeNanoseconds - startedAt.uptimeNanoseconds) / 1_000_000_000
+                    if coalescing.minimumInterval > elapsed {
+                        try await Task.sleep(nanoseconds: UInt64((coalescing.minimumInterval - elapsed) * 1_000_000_000))
+                    }
+                }
+            } catch {
+                if !(error is CancellationError) {
+                    await self?.deliver(.failure(error), latest: nil, to: key, generation: generation)
+                }
+            }
+        }
+    }
+
+    private func deliver(_ event: Event, latest: [ZyraRow]?, to key: Key, generation: UUID) {
+        guard let watch = watches[key], watch.generation == generation else { return }
+
+        if let latest = latest {
+            watch.latest = latest
+        } else {
+            // A failed watch cannot be shared any more; the next subscriber starts a fresh one
+            watches[key] = nil
+        }
+        for handler in watch.subscribers.values {
+            handler(event)
+        }
+    }
+
+    /// Collapse whitespace outside quotes so formatting differences do not split a shared watch
+    /// String literals and quoted identifiers are kept verbatim (a doubled quote inside one closes and
+    /// reopens it, which leaves its text unchanged), so queries differing only inside quotes stay apart
+    static func normalize(_ sql: String) -> String {
+        var normalized = ""
+        normalized.reserveCapacity(sql.count)
+        var quote: Character?
+        var pendingSpace = false
+
+        for character in sql {
+            if let open = quote {
+                normalized.append(character)
+                if character == open {
+                    quote = nil
+                }
+                continue
+            }
+
+            if character.isWhitespace {
+                pendingSpace = !normalized.isEmpty
+                continue
+            }
+            if pendingSpace {
+                normalized.append(" ")
+                pendingSpace = false
+            }
+            if character == "'" || character == "\"" || character == "`" {
+                quote = character
+            }
+            normalized.append(character)
+        }
+        return normalized
+    }
+}
+
+/// A subscriber's membership of a shared watch
+/// Cancelling (or releasing) it removes the subscriber; the last one out stops the watch
+public final class ZyraWatchSubscription: @unchecked Sendable {
+    private weak var hub: ZyraWatchHub?
+    private let key: ZyraWatchHub.Key
+    private let id: UUID
+    private let lock = NSLock()
+    private var isCancelled = false
+
+    /// Emission counters of the shared watch (received, dropped while busy, published)
+    public let statistics: ZyraWatchStatistics
+
+    init(hub: ZyraWatchHub, key: ZyraWatchHub.Key, id: UUID, statistics: ZyraWatchStatistics) {
+        self.hub = hub
+        self.key = key
+        self.id = id
+        self.statistics = statistics
+    }
+
+    deinit {
+        cancel()
+    }
+
+    /// Leave the shared watch; safe to call more than once and from any thread
+    public func cancel() {
+        lock.lock()
+        let alreadyCancelled = isCancelled
+        isCancelled = true
+        lock.unlock()
+
+        guard !alreadyCancelled else { return }
+
+        let hub = self.hub
+        let key = self.key
+        let id = self.id
+        Task { @MainActor in
+            hub?.unsubscribe(key: key, id: id)
+        }
+    }
+}
@@ -0,0 +1,141 @@
+//
+//  ZyraWatchReadiness.swift
+//  ZyraForm
+//
+//  Awaitable first-snapshot readiness for PowerSync watches
+//
+
+import Foundation
+
+/// Signals when a watch has decoded and published its first emission
+/// One instance per started watch; waiters resume with the time-to-first-row,
+/// or with the watch's error if it fails before producing anything.
+/// A watch replaced or stopped before its first snapshot releases its waiters normally,
+/// as `loadRecords` always returned before watches became awaitable
+final class ZyraWatchReadiness: @unchecked Sendable {
+    private let lock = NSLock()
+    private let startedAt = DispatchTime.now()
+    private var result: Result<TimeInterval, Error>?
+    private var waiters: [UUID: CheckedContinuation<TimeInterval, Error>] = [:]
+    private var timeouts: [UUID: Task<Void, Never>] = [:]
+
+    /// Time from watch start to the first published snapshot, nil until then
+    var timeToFirstRow: TimeInterval? {
+        lock.lock()
+        defer { lock.unlock() }
+        return try? result?.get()
+    }
+
+    /// Mark the first snapshot as published
+    /// - Returns: Time-to-first-row, or nil if the watch was already resolved
+    @discardableResult
+    func succeed() -> TimeInterval? {
+        let elapsed = TimeInterval(DispatchTime.now().uptimeNanoseconds - startedAt.uptimeNanoseconds) / 1_000_000_000
+        return resolve(.success(elapsed)) ? elapsed : nil
+    }
+
+    /// Fail the watch before its first snapshot; ignored once resolved
+    func fail(_ error: Error) {
+        resolve(.failure(error))
+    }
+
+    /// The watch was replaced or stopped: release waiters without an error; ignored once resolved
+    func supersede() {
+        let elapsed = TimeInterval(DispatchTime.now().uptimeNanoseconds - startedAt.uptimeNanoseconds) / 1_000_000_000
+        resolve(.success(elapsed))
+    }
+
+    /// Wait for the first snapshot
+    /// - Parameter timeout: Maximum seconds to wait (nil = until the watch resolves)
+    /// - Returns: Time-to-first-row in seconds
+    func wait(timeout: TimeInterval?) async throws -> TimeInterval {
+        let id = UUID()
+
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                lock.lock()
+                if let result = result {
+                    lock.unlock()
+                    continuation.resume(with: result)
+                    return
+                }
+                waiters[id] = continuation
+                lock.unlock()
+
+                if Task.isCancelled {
+                    resumeWaiter(id, throwing: CancellationError())
+                } else if let timeout = timeout {
+                    let timer = Task.detached { [weak self] in
+                        try? await Task.sleep(nanoseconds: UInt64(max(0, timeout) * 1_000_000_000))
+                        guard !Task.isCancelled else { return }
+                        self?.resumeWaiter(id, throwing: ZyraSyncError.firstSnapshotTimeout(timeout))
+                    }
+                    // The wait may have ended while the timer was being created
+                    lock.lock()
+                    if waiters[id] != nil {
+                        timeouts[id] = timer
+                        lock.unlock()
+                    } else {
+                        lock.unlock()
+                        timer.cancel()
+                    }
+                }
+            }
+        } onCancel: {
+            resumeWaiter(id, throwing: CancellationError())
+        }
+    }
+
+    // MARK: - Helpers
+
+    @discardableResult
+    private func resolve(_ outcome: Result<TimeInterval, Error>) -> Bool {
+        lock.lock()
+        guard result == nil else {
+            lock.unlock()
+            return false
+        }
+        result = outcome
+        let pending = waiters
+        let timers = timeouts
+        waiters.removeAll()
+        timeouts.removeAll()
+        lock.unlock()
+
+        for timer in timers.values {
+            timer.cancel()
+        }
+        for continuation in pending.values {
+            continuation.resume(with: outcome)
+        }
+        return true
+    }
+
+    private func resumeWaiter(_ id: UUID, throwing error: Error) {
+        lock.lock()
+        let continuation = waiters.removeValue(forKey: id)
+        let timer = timeouts.removeValue(forKey: id)
+        lock.unlock()
+
+        timer?.cancel()
+        continuation?.resume(throwing: error)
+    }
+}
+
+// MARK: - ZyraSync Errors
+public enum ZyraSyncError: LocalizedError {
+    case firstSnapshotTimeout(TimeInterval)
+    case watchNotStarted
+    case serviceReleased(String)
+
+    public var errorDescription: String? {
+        switch self {
+        case .firstSnapshotTimeout(let timeout):
+            return "Watch did not produce its first snapshot within \(timeout) seconds"
+        case .watchNotStarted:
+            return "No watch has been started"
+        case .serviceReleased(let table):
+            return "The service for \(table) was released before its write-behind updates were written"
+        }
+    }
+}
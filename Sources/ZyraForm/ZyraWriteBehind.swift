@@ -0,0 +1,278 @@
+//
+//  ZyraWriteBehind.swift
+//  ZyraForm
+//
+//  Opt-in write-behind queue coalescing frequent updates to the same record
+//
+
+import Foundation
+#if canImport(UIKit) && !os(watchOS)
+import UIKit
+#elseif canImport(AppKit)
+import AppKit
+#endif
+
+/// Write-behind settings for `ZyraSync.updateRecord`
+/// Updates to a record are merged field-wise in memory (later values win) and written as one UPDATE
+/// per record when the window closes, on `flushPendingWrites()`, or when the app leaves the foreground.
+/// Meant for autosaving forms that update on every edit; reads of the service see pending values
+public struct ZyraWriteBehind: Hashable, Sendable {
+    /// Seconds from the first pending update to the flush that writes it
+    public var window: TimeInterval
+
+    /// Flush when the app enters the background (iOS) or resigns active / terminates (macOS)
+    public var flushesOnBackground: Bool
+
+    /// - Parameters:
+    ///   - window: Seconds pending updates are held before they are written
+    ///   - flushesOnBackground: Flush when the app leaves the foreground
+    public init(window: TimeInterval = 2, flushesOnBackground: Bool = true) {
+        self.window = max(0, window)
+        self.flushesOnBackground = flushesOnBackground
+    }
+
+    /// Two-second window, flushed on background
+    public static let `default` = ZyraWriteBehind()
+}
+
+// MARK: - Pending Updates
+
+/// Fields waiting to be written to one record
+struct ZyraPendingUpdate {
+    let id: String
+    var fields: [String: Any]
+    var encryptedFields: Set<String>
+    var blindIndexedFields: Set<String>
+    var autoTimestamp: Bool
+
+    /// Apply a newer update on top of this one
+    mutating func merge(_ newer: ZyraPendingUpdate) {
+        fields.merge(newer.fields) { _, latest in latest }
+        encryptedFields.formUnion(newer.encryptedFields)
+        blindIndexedFields.formUnion(newer.blindIndexedFields)
+        autoTimestamp = autoTimestamp || newer.autoTimestamp
+    }
+}
+
+// MARK: - Queue
+
+/// Pending updates of one `ZyraSync`, keyed by canonical id
+/// Flushes run one after another; updates are held (and visible to reads) until their flush has
+/// committed, and a failed flush (including a writer whose service is gone) puts its updates back under any newer ones
+@MainActor
+final class ZyraWriteBehindQueue {
+    typealias Writer = @MainActor ([ZyraPendingUpdate]) async throws -> Void
+
+    var settings: ZyraWriteBehind {
+        didSet {
+            if settings.flushesOnBackground != oldValue.flushesOnBackground {
+                observeLifecycle()
+            }
+        }
+    }
+
+    private let table: String
+
+    /// Writes a batch; replaced when the owning service hands its pending updates to a successor
+    var write: Writer
+    private var pending: [String: ZyraPendingUpdate] = [:]
+    private var order: [String] = []
+    private var writing: [String: ZyraPendingUpdate] = [:]
+    private var timer: Task<Void, Never>?
+    private var flushing: Task<Void, Error>?
+    private var observers: [NSObjectProtocol] = []
+    #if canImport(UIKit) && !os(watchOS)
+    private var backgroundTask = UIBackgroundTaskIdentifier.invalid
+    #endif
+
+    init(settings: ZyraWriteBehind, table: String, write: @escaping Writer) {
+        self.settings = settings
+        self.table = table
+        self.write = write
+        observeLifecycle()
+    }
+
+    deinit {
+        timer?.cancel()
+        for observer in observers {
+            NotificationCenter.default.removeObserver(observer)
+        }
+    }
+
+    /// Records with updates not yet written
+    var count: Int {
+        return Set(order).union(writing.keys).count
+    }
+
+    var isEmpty: Bool {
+        return pending.isEmpty && writing.isEmpty
+    }
+
+    // MARK: - Enqueueing
+
+    /// Merge an update into the record's pending fields and start the window if it is not running
+    func enqueue(_ update: ZyraPendingUpdate) {
+        let id = ZyraSync.canonicalId(update.id)
+        if pending[id] != nil {
+            pending[id]?.merge(update)
+        } else {
+            pending[id] = update
+            order.append(id)
+        }
+        scheduleFlush()
+    }
+
+    /// Fields of `id` not yet written, newest values on top (nil when there are none)
+    func pendingFields(for id: String) -> [String: Any]? {
+        let id = ZyraSync.canonicalId(id)
+        switch (writing[id], pending[id]) {
+        case (nil, nil):
+            return nil
+        case let (written?, nil):
+            return written.fields
+        case let (nil, queued?):
+            return queued.fields
+        case let (written?, queued?):
+            return written.fields.merging(queued.fields) { _, latest in latest }
+        }
+    }
+
+    /// Forget the pending updates of deleted records
+    func discard(ids: [String]) {
+        let removed = Set(ids.map { ZyraSync.canonicalId($0) })
+        for id in removed {
+            pending[id] = nil
+        }
+        order.removeAll { removed.contains($0) }
+    }
+
+    // MARK: - Flushing
+
+    /// Write every pending update, after any flush already running
+    func flush() async throws {
+        timer?.cancel()
+        timer = nil
+
+        let previous = flushing
+        let task = Task { @MainActor in
+            // Updates of a failed earlier flush are back in `pending` and go out with this one
+            _ = try? await previous?.value
+            try await self.writePending()
+        }
+        flushing = task
+        try await task.value
+    }
+
+    private func writePending() async throws {
+        let batch = order.compactMap { pending[$0] }
+        pending.removeAll()
+        order.removeAll()
+        guard !batch.isEmpty else { return }
+
+        for update in batch {
+            writing[ZyraSync.canonicalId(update.id)] = update
+        }
+        defer { writing.removeAll() }
+
+        do {
+            try await write(batch)
+            ZyraFormLogger.debug("🕒 Flushed write-behind updates of \(batch.count) \(table) records")
+        } catch {
+            restore(batch)
+            throw error
+        }
+    }
+
+    /// Put failed updates back, under the values enqueued while they were being written
+    private func restore(_ batch: [ZyraPendingUpdate]) {
+        for var update in batch.reversed() {
+            let id = ZyraSync.canonicalId(update.id)
+            if let newer = pending[id] {
+                update.merge(newer)
+            } else {
+                order.insert(id, at: 0)
+            }
+            pending[id] = update
+        }
+        scheduleFlush()
+    }
+
+    private func scheduleFlush() {
+        guard timer == nil, !pending.isEmpty else { return }
+
+        let nanoseconds = UInt64(settings.window * 1_000_000_000)
+        timer = Task { @MainActor [weak self] in
+            try? await Task.sleep(nanoseconds: nanoseconds)
+            guard !Task.isCancelled, let self = self else { return }
+            self.timer = nil
+            await self.flushLogged(reason: "window")
+        }
+    }
+
+    private func flushLogged(reason: String) async {
+        do {
+            try await flush()
+        } catch {
+            ZyraFormLogger.error("❌ Write-behind flush (\(reason)) failed for \(table): \(error.localizedDescription)")
+        }
+    }
+
+    // MARK: - App Lifecycle
+
+    private func observeLifecycle() {
+        for observer in observers {
+            NotificationCenter.default.removeObserver(observer)
+        }
+        observers.removeAll()
+        guard settings.flushesOnBackground else { return }
+
+        #if canImport(UIKit) && !os(watchOS)
+        observers.append(NotificationCenter.default.addObserver(
+            forName: UIApplication.didEnterBackgroundNotification,
+            object: nil,
+            queue: .main
+        ) { [weak self] _ in
+            MainActor.assumeIsolated {
+                self?.flushInBackground()
+            }
+        })
+        #elseif canImport(AppKit)
+        for name in [NSApplication.willResignActiveNotification, NSApplication.willTerminateNotification] {
+            observers.append(NotificationCenter.default.addObserver(
+                forName: name,
+                object: nil,
+                queue: .main
+            ) { [weak self] _ in
+                MainActor.assumeIsolated {
+                    guard let self = self, !self.isEmpty else { return }
+                    Task { await self.flushLogged(reason: "resign active") }
+                }
+            })
+        }
+        #endif
+    }
+
+    #if canImport(UIKit) && !os(watchOS)
+    /// Flush while iOS grants background time
+    private func flushInBackground() {
+        guard !isEmpty, backgroundTask == .invalid else { return }
+
+        backgroundTask = UIApplication.shared.beginBackgroundTask(withName: "ZyraForm write-behind") { [weak self] in
+            MainActor.assumeIsolated {
+                self?.endBackgroundTask()
+            }
+        }
+
+        Task { @MainActor [weak self] in
+            await self?.flushLogged(reason: "background")
+            self?.endBackgroundTask()
+        }
+    }
+
+    private func endBackgroundTask() {
+        guard backgroundTask != .invalid else { return }
+        UIApplication.shared.endBackgroundTask(backgroundTask)
+        backgroundTask = .invalid
+    }
+    #endif
+}
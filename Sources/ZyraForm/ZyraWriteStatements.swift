@@ -0,0 +1,162 @@
+//
+//  ZyraWriteStatements.swift
+//  ZyraForm
+//
+//  Stable column order and cached SQL text for INSERT/UPDATE/DELETE
+//
+
+import Foundation
+
+// MARK: - Column Order
+
+/// Order of the columns a service writes
+/// Columns are put in schema order (columns the schema does not list follow, sorted by name), so the same
+/// logical write always produces the same statement shape. Each service holds its own order
+public struct ZyraColumnOrder: Sendable {
+    private let rank: [String: Int]
+
+    /// Order like `columns` (the schema's columns); empty orders every column by name
+    public init(_ columns: [String] = []) {
+        var rank = [String: Int](minimumCapacity: columns.count)
+        for (ordinal, column) in columns.enumerated() where rank[column] == nil {
+            rank[column] = ordinal
+        }
+        self.rank = rank
+    }
+
+    /// `columns` in schema order, then the unknown ones by name
+    public func ordered<Columns: Sequence>(_ columns: Columns) -> [String] where Columns.Element == String {
+        return columns.sorted { lhs, rhs in
+            switch (rank[lhs], rank[rhs]) {
+            case let (left?, right?):
+                return left < right
+            case (.some, nil):
+                return true
+            case (nil, .some):
+                return false
+            case (nil, nil):
+                return lhs < rhs
+            }
+        }
+    }
+}
+
+// MARK: - Statements
+
+/// SQL text of the writes to one table
+/// The SQL of each statement shape is built once, so a write binds its values positionally into the same
+/// string every time and prepared statements can be reused. At most `capacity` shapes are kept; row and id
+/// counts vary with the size of a batch, so when the cache is full it starts over
+public final class ZyraWriteStatements: @unchecked Sendable {
+    // MARK: - Registry
+
+    private static let registryLock = NSLock()
+    private static var registry: [String: ZyraWriteStatements] = [:]
+
+    /// The statements shared by all services writing `table`
+    public static func shared(for table: String) -> ZyraWriteStatements {
+        registryLock.lock()
+        defer { registryLock.unlock() }
+
+        if let statements = registry[table] {
+            return statements
+        }
+        let statements = ZyraWriteStatements(table: table)
+        registry[table] = statements
+        return statements
+    }
+
+    // MARK: - Shapes
+
+    enum Shape: Hashable {
+        /// `INSERT INTO t (columns) VALUES (...) x rows`
+        case insert(columns: [String], rows: Int)
+        /// `UPDATE t SET columns` with `WHERE id IN (...)` over `ids` placeholders (nil = no WHERE)
+        case update(columns: [String], ids: Int?)
+        /// `DELETE FROM t WHERE id IN (...)`
+        case delete(ids: Int)
+    }
+
+    public let table: String
+
+    /// Most statements kept at once
+    public let capacity: Int
+
+    private let lock = NSLock()
+    private var cache: [Shape: String] = [:]
+
+    init(table: String, capacity: Int = 256) {
+        self.table = table
+        self.capacity = max(1, capacity)
+    }
+
+    /// Number of cached statements
+    public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return cache.count
+    }
+
+    /// Drop every cached statement
+    public func removeAll() {
+        lock.lock()
+        cache.removeAll()
+        lock.unlock()
+    }
+
+    // MARK: - SQL
+
+    /// `INSERT INTO table (columns) VALUES (...), (...)` with `rowCount` rows of placeholders
+    public func insertSQL(columns: [String], rowCount: Int) -> String {
+        return sql(for: .insert(columns: columns, rows: rowCount))
+    }
+
+    /// `UPDATE table SET "a" = ?, ...`, followed by `WHERE id IN (...)` when `idCount` is given
+    public func updateSQL(columns: [String], idCount: Int? = nil) -> String {
+        return sql(for: .update(columns: columns, ids: idCount))
+    }
+
+    /// `DELETE FROM table WHERE id IN (...)`
+    public func deleteSQL(idCount: Int) -> String {
+        return sql(for: .delete(ids: idCount))
+    }
+
+    private func sql(for shape: Shape) -> String {
+        lock.lock()
+        if let cached = cache[shape] {
+            lock.unlock()
+            return cached
+        }
+        lock.unlock()
+
+        let built = build(shape)
+
+        lock.lock()
+        if cache.count >= capacity {
+            cache.removeAll(keepingCapacity: true)
+        }
+        cache[shape] = built
+        lock.unlock()
+        return built
+    }
+
+    private func build(_ shape: Shape) -> String {
+        switch shape {
+        case .insert(let columns, let rows):
+            let quoted = columns.map { "\"\($0)\"" }.joined(separator: ", ")
+            let row = "(\(ZyraWriteStatements.placeholders(columns.count)))"
+            return "INSERT INTO \"\(table)\" (\(quoted)) VALUES \(Array(repeating: row, count: rows).joined(separator: ", "))"
+        case .update(let columns, let ids):
+            let assignments = columns.map { "\"\($0)\" = ?" }.joined(separator: ", ")
+            let sql = "UPDATE \"\(table)\" SET \(assignments)"
+            return ids.map { "\(sql) WHERE id IN (\(ZyraWriteStatements.placeholders($0)))" } ?? sql
+        case .delete(let ids):
+            return "DELETE FROM \"\(table)\" WHERE id IN (\(ZyraWriteStatements.placeholders(ids)))"
+        }
+    }
+
+    /// `?, ?, ...` with `count` placeholders
+    static func placeholders(_ count: Int) -> String {
+        return Array(repeating: "?", count: count).joined(separator: ", ")
+    }
+}
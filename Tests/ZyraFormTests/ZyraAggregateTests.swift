@@ -0,0 +1,47 @@
+//
+//  ZyraAggregateTests.swift
+//  ZyraFormTests
+//
+//  SQL shape and results of SQLite-side aggregates
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+final class ZyraAggregateTests: XCTestCase {
+    func testAggregateCompilesToSQLiteAggregates() throws {
+        let compiled = try BenchmarkTask.query()
+            .where("user_id", equals: "user-1")
+            .aggregate(.count(), .sum("estimate"), .average("priority"), groupBy: ["status"])
+            .compile()
+
+        XCTAssertEqual(
+            compiled.sql,
+            "SELECT \"status\", COUNT(*) AS \"count\", SUM(\"estimate\") AS \"sum_estimate\", AVG(\"priority\") AS \"avg_priority\" FROM \"benchmark_tasks\" WHERE \"user_id\" = ? GROUP BY \"status\" ORDER BY \"status\""
+        )
+        XCTAssertEqual(compiled.layout.names, ["status", "count", "sum_estimate", "avg_priority"])
+
+        // Ciphertext can be counted but not summed, ranged or grouped
+        let secrets = ZyraTable(name: "secrets", columns: [zf.text("note").encrypted(), zf.integer("amount").encrypted()])
+        XCTAssertNoThrow(try secrets.query().aggregate(.count("note")).compile())
+        XCTAssertThrowsError(try secrets.query().aggregate(.sum("amount")).compile())
+        XCTAssertThrowsError(try secrets.query().aggregate(.max("note")).compile())
+        XCTAssertThrowsError(try secrets.query().aggregate(.count(), groupBy: ["note"]).compile())
+    }
+
+    @MainActor
+    func testCountRunsInSQLite() async throws {
+        let database = ZyraTestDatabase.open("aggregate-count")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        _ = try await ZyraTestDatabase.insertTasks(["One", "Two", "Three"], into: service)
+
+        let all = try await service.count(BenchmarkTask.query())
+        let filtered = try await service.count(BenchmarkTask.query().where("title", equals: "Two"))
+        XCTAssertEqual(all, 3)
+        XCTAssertEqual(filtered, 1)
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
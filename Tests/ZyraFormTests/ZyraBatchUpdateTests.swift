@@ -0,0 +1,90 @@
+//
+//  ZyraBatchUpdateTests.swift
+//  ZyraFormTests
+//
+//  Set-based and per-record batched updates
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraBatchUpdateTests: XCTestCase {
+    /// Table of its own, so the statement shapes counted here come from this test only
+    private let table = ZyraTable(name: "batch_update_tasks", columns: [
+        zf.text("id").notNull(),
+        zf.text("title").notNull(),
+        zf.text("secret").encrypted().nullable(),
+        zf.integer("priority").notNull(),
+        zf.text("created_at").notNull(),
+        zf.text("updated_at").notNull()
+    ])
+
+    private func open(_ name: String) -> PowerSyncDatabaseProtocol {
+        return PowerSyncDatabase(
+            schema: PowerSync.Schema(tables: [table.toPowerSyncTable()]),
+            dbFilename: "zyra-\(name)-\(UUID().uuidString).db"
+        )
+    }
+
+    func testSetValuesAreEncryptedOnceAndDecryptPerRow() async throws {
+        let database = open("update-where")
+        let service = ZyraSync(tableName: table.name, userId: "user-1", database: database)
+        _ = try await service.createRecords(records: (0..<3).map { ["title": "Task \($0)", "priority": $0] })
+
+        try await service.updateRecords(
+            where: "priority < ?",
+            parameters: [2],
+            set: ["secret": "Shared secret"],
+            encryptedFields: ["secret"]
+        )
+
+        // One ciphertext bound to every matched row
+        let stored = try await service.fetchRows(fields: ["secret"], orderBy: "priority")
+        let ciphertexts = stored.map { $0.string("secret") }
+        XCTAssertNotNil(ciphertexts[0])
+        XCTAssertNotEqual(ciphertexts[0], "Shared secret")
+        XCTAssertEqual(ciphertexts[1], ciphertexts[0])
+        XCTAssertNil(ciphertexts[2])
+
+        let decrypted = try await service.fetchRows(fields: ["secret"], orderBy: "priority", encryptedFields: ["secret"])
+        XCTAssertEqual(decrypted.map { $0.string("secret") }, ["Shared secret", "Shared secret", nil])
+
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testRecordsSettingTheSameColumnsShareAStatement() async throws {
+        let database = open("update-records")
+        let service = ZyraSync(tableName: table.name, userId: "user-1", database: database)
+        let ids = try await service.createRecords(records: (0..<3).map { ["title": "Task \($0)", "priority": $0] })
+
+        let shapes = service.writeStatements.count
+        try await service.updateRecords([
+            (id: ids[0], fields: ["title": "First", "secret": "One"]),
+            (id: ids[1], fields: ["title": "Second", "secret": "Two"]),
+            (id: ids[2], fields: ["priority": 5])
+        ], encryptedFields: ["secret"])
+
+        // Two column sets, two statement shapes
+        XCTAssertEqual(service.writeStatements.count, shapes + 2)
+
+        let rows = try await service.fetchRows(
+            fields: ["id", "title", "secret", "priority"],
+            orderBy: "priority",
+            encryptedFields: ["secret"],
+            integerFields: ["priority"]
+        )
+        XCTAssertEqual(rows.map { $0.string("title") }, ["First", "Second", "Task 2"])
+        XCTAssertEqual(rows.map { $0.string("secret") }, ["One", "Two", nil])
+        XCTAssertEqual(rows.last?.value("priority").intValue, 5)
+
+        // Each record's value is encrypted on its own
+        let stored = try await service.fetchRows(fields: ["secret"], orderBy: "priority")
+        XCTAssertNotEqual(stored[0].string("secret"), stored[1].string("secret"))
+        XCTAssertNotEqual(stored[0].string("secret"), "One")
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
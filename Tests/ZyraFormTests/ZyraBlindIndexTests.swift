@@ -0,0 +1,45 @@
+//
+//  ZyraBlindIndexTests.swift
+//  ZyraFormTests
+//
+//  Blind-index token columns for equality lookups on encrypted columns
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+final class ZyraBlindIndexTests: XCTestCase {
+    private let contacts = ZyraTable(name: "contacts", columns: [
+        zf.text("id").notNull(),
+        zf.text("email").encrypted().blindIndexed(),
+        zf.text("phone").encrypted()
+    ])
+
+    func testEqualityUsesTokenColumn() throws {
+        XCTAssertEqual(contacts.fieldConfig.blindIndexedFields, ["email"])
+        XCTAssertTrue(contacts.indexes.contains { $0.name == "contacts_email_bidx" })
+
+        let lookup = try contacts.query().where("email", equals: "Ada@Example.com").whereIn("email", ["a", "b"]).compile()
+        XCTAssertTrue(lookup.sql.contains("WHERE \"email_bidx\" = ? AND \"email_bidx\" IN (?, ?)"))
+
+        // Ranges and other encrypted columns still cannot be filtered
+        XCTAssertThrowsError(try contacts.query().where("email", .like, "a%").compile())
+        XCTAssertThrowsError(try contacts.query().where("phone", equals: "1").compile())
+    }
+
+    func testTokenColumnIsStoredButNotAModelField() {
+        // Not a model column: field lists, loads, forms and generated models never see it
+        XCTAssertNil(contacts.column(named: "email_bidx"))
+        XCTAssertFalse(contacts.fieldConfig.allFields.contains("email_bidx"))
+        XCTAssertFalse(contacts.listProjection.contains("email_bidx"))
+        XCTAssertFalse(contacts.generateSwiftModel().contains("bidx"))
+
+        // Stored: part of the local PowerSync table and of the server DDL
+        XCTAssertEqual(contacts.blindIndexColumns.map { $0.name }, ["email_bidx"])
+        XCTAssertTrue(contacts.storedColumns.contains { $0.name == "email_bidx" })
+        XCTAssertTrue(contacts.toPowerSyncTable().columns.contains { $0.name == "email_bidx" })
+        XCTAssertTrue(contacts.generateCreateTableSQL().contains("email_bidx"))
+    }
+}
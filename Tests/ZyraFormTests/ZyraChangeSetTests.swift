@@ -0,0 +1,82 @@
+//
+//  ZyraChangeSetTests.swift
+//  ZyraFormTests
+//
+//  Keyed change sets and row reuse between watch emissions
+//
+
+import Foundation
+import XCTest
+import ZyraForm
+
+final class ZyraChangeSetTests: XCTestCase {
+    private let columns = ["id", "title", "updated_at"]
+
+    private func rows(_ values: [(String, String, String)]) -> [ZyraRow] {
+        let layout = ZyraRowLayout(names: columns)
+        return values.map { ZyraRow(layout: layout, values: [.text($0.0), .text($0.1), .text($0.2)]) }
+    }
+
+    /// Decode one emission the way the watch hub does: read, finish, then diff with the stored values
+    private func emit(_ values: [[Any?]], decoder: ZyraRowDecoder, differ: ZyraRowDiffer) -> ([ZyraRow], ZyraChangeSet) {
+        let cursor = BenchmarkCursor(columns: columns, rows: values)
+        let raw = values.indices.map { index -> ZyraRawRow in
+            cursor.row = index
+            return decoder.read(cursor)
+        }
+        let decoded = decoder.finish(raw)
+        return (decoded, differ.apply(decoded, stored: raw))
+    }
+
+    func testFirstSnapshotIsReset() {
+        let differ = ZyraRowDiffer()
+        let changes = differ.apply(rows([("a", "A", "1"), ("b", "B", "1")]))
+
+        XCTAssertTrue(changes.isReset)
+        XCTAssertEqual(changes.inserted.map { $0.id }, ["a", "b"])
+    }
+
+    func testInsertRemoveMoveAndUpdate() {
+        let differ = ZyraRowDiffer()
+        _ = differ.apply(rows([("a", "A", "1"), ("b", "B", "1"), ("c", "C", "1")]))
+
+        let changes = differ.apply(rows([("c", "C", "1"), ("a", "A2", "2"), ("d", "D", "1")]))
+
+        XCTAssertFalse(changes.isReset)
+        XCTAssertEqual(changes.inserted.map { $0.id }, ["d"])
+        XCTAssertEqual(changes.inserted.first?.index, 2)
+        XCTAssertEqual(changes.removed.map { $0.id }, ["b"])
+        XCTAssertEqual(changes.updated.map { $0.id }, ["a"])
+        XCTAssertEqual(changes.moved.count, 1)
+        XCTAssertEqual(changes.changedIds, ["a", "d"])
+    }
+
+    func testEditWithUnchangedVersionIsAnUpdate() {
+        // Two edits within the same second (or one without autoTimestamp) keep `updated_at`
+        let differ = ZyraRowDiffer()
+        _ = differ.apply(rows([("a", "Draft", "2025-01-01T00:00:00Z")]))
+
+        let changes = differ.apply(rows([("a", "Final", "2025-01-01T00:00:00Z")]))
+        XCTAssertEqual(changes.updated.map { $0.id }, ["a"])
+
+        let unchanged = differ.apply(rows([("a", "Final", "2025-01-01T00:00:00Z")]))
+        XCTAssertTrue(unchanged.isEmpty)
+    }
+
+    func testDecoderReusesRowsOnlyWhenStoredValuesMatch() {
+        let differ = ZyraRowDiffer()
+        let decoder = ZyraRowDecoder(
+            plan: ZyraDecodePlan(fields: columns, fieldsMatchSelectOrder: true),
+            userId: "user-1",
+            encryptionManager: .shared,
+            rowReuse: differ
+        )
+        let version = "2025-01-01T00:00:00Z"
+
+        _ = emit([["a", "Draft", version], ["b", "Other", version]], decoder: decoder, differ: differ)
+        let (decoded, changes) = emit([["a", "Final", version], ["b", "Other", version]], decoder: decoder, differ: differ)
+
+        XCTAssertEqual(decoded.map { $0.string("title") }, ["Final", "Other"])
+        XCTAssertEqual(changes.updated.map { $0.id }, ["a"])
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  ZyraDecryptCacheTests.swift
+//  ZyraFormTests
+//
+//  Hits, invalidation and eviction of the decrypted-value cache
+//
+
+import Foundation
+import XCTest
+import ZyraForm
+
+final class ZyraDecryptCacheTests: XCTestCase {
+    func testHitRequiresSameVersionAndCiphertext() {
+        let cache = ZyraDecryptCache(table: "decrypt_cache_hits")
+        cache.store("secret", id: "a", version: "1", field: "title", ciphertext: "c1", userId: "user-1")
+
+        XCTAssertEqual(cache.plaintext(id: "a", version: "1", field: "title", ciphertext: "c1", userId: "user-1"), "secret")
+        // A new version, or new ciphertext under the same version, is decrypted again
+        XCTAssertNil(cache.plaintext(id: "a", version: "2", field: "title", ciphertext: "c1", userId: "user-1"))
+        XCTAssertNil(cache.plaintext(id: "a", version: "1", field: "title", ciphertext: "c2", userId: "user-1"))
+        XCTAssertNil(cache.plaintext(id: "a", version: "1", field: "body", ciphertext: "c1", userId: "user-1"))
+
+        XCTAssertEqual(cache.hits, 1)
+        XCTAssertEqual(cache.misses, 3)
+    }
+
+    func testSwitchingUserDropsEverything() {
+        let cache = ZyraDecryptCache(table: "decrypt_cache_users")
+        cache.store("secret", id: "a", version: "1", field: "title", ciphertext: "c1", userId: "user-1")
+
+        XCTAssertNil(cache.plaintext(id: "a", version: "1", field: "title", ciphertext: "c1", userId: "user-2"))
+        XCTAssertEqual(cache.count, 0)
+    }
+
+    func testInvalidateAllClearsSharedCaches() {
+        let cache = ZyraDecryptCache.shared(for: "decrypt_cache_shared")
+        cache.store("secret", id: "a", version: "1", field: "title", ciphertext: "c1", userId: "user-1")
+        XCTAssertTrue(ZyraDecryptCache.shared(for: "decrypt_cache_shared") === cache)
+
+        ZyraDecryptCache.invalidateAll()
+
+        XCTAssertEqual(cache.count, 0)
+        XCTAssertNil(cache.plaintext(id: "a", version: "1", field: "title", ciphertext: "c1", userId: "user-1"))
+    }
+
+    func testLeastRecentlyUsedRowIsEvicted() {
+        let cache = ZyraDecryptCache(table: "decrypt_cache_lru", capacity: 2)
+        cache.store("A", id: "a", version: "1", field: "title", ciphertext: "ca", userId: "user-1")
+        cache.store("B", id: "b", version: "1", field: "title", ciphertext: "cb", userId: "user-1")
+
+        // Touch "a" so "b" is the least recently used when "c" arrives
+        _ = cache.plaintext(id: "a", version: "1", field: "title", ciphertext: "ca", userId: "user-1")
+        cache.store("C", id: "c", version: "1", field: "title", ciphertext: "cc", userId: "user-1")
+
+        XCTAssertEqual(cache.count, 2)
+        XCTAssertNil(cache.plaintext(id: "b", version: "1", field: "title", ciphertext: "cb", userId: "user-1"))
+        XCTAssertEqual(cache.plaintext(id: "a", version: "1", field: "title", ciphertext: "ca", userId: "user-1"), "A")
+        XCTAssertEqual(cache.plaintext(id: "c", version: "1", field: "title", ciphertext: "cc", userId: "user-1"), "C")
+    }
+}
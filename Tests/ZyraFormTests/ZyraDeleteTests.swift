@@ -0,0 +1,57 @@
+//
+//  ZyraDeleteTests.swift
+//  ZyraFormTests
+//
+//  Batched deletes by id: chunking, legacy uppercase ids and one transaction
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraDeleteTests: XCTestCase {
+    private func count(_ sql: String, in database: PowerSyncDatabaseProtocol) async throws -> Int {
+        let counts = try await database.getAll(sql: sql, parameters: [], mapper: { cursor in
+            cursor.getIntOptional(index: 0) ?? 0
+        })
+        return counts.first ?? 0
+    }
+
+    func testDeletesManyIdsInOneTransaction() async throws {
+        let database = ZyraTestDatabase.open("delete-batch")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let table = BenchmarkTask.schema.name
+
+        // Each id binds its stored forms, so 1,200 ids take several statements of at most 999 values
+        let ids = try await ZyraTestDatabase.insertTasks((0..<1_200).map { "Task \($0)" }, into: service)
+        let kept = try await ZyraTestDatabase.insertTasks(["Kept"], into: service)
+
+        // Written with an uppercase id, before ids were canonicalized
+        let legacy = UUID().uuidString
+        try await database.execute(
+            sql: "INSERT INTO \"\(table)\" (id, user_id, title) VALUES (?, 'user-1', 'Legacy')",
+            parameters: [legacy]
+        )
+
+        // Case-sensitive matching leaves the legacy row alone
+        try await service.deleteRecords(ids: [legacy.lowercased()], caseInsensitive: false)
+        var remaining = try await count("SELECT COUNT(*) FROM \"\(table)\"", in: database)
+        XCTAssertEqual(remaining, ids.count + 2)
+
+        try await service.deleteRecords(ids: ids + [legacy.lowercased()])
+        remaining = try await count("SELECT COUNT(*) FROM \"\(table)\"", in: database)
+        XCTAssertEqual(remaining, 1)
+        let rows = try await service.fetchRows(fields: ["id"], orderBy: "priority")
+        XCTAssertEqual(rows.map { $0.string("id") }, kept)
+
+        // One CRUD transaction holds every delete
+        let deletes = try await count("SELECT COUNT(*) FROM ps_crud WHERE json_extract(data, '$.op') = 'DELETE'", in: database)
+        let transactions = try await count("SELECT COUNT(DISTINCT tx_id) FROM ps_crud WHERE json_extract(data, '$.op') = 'DELETE'", in: database)
+        XCTAssertEqual(deletes, ids.count + 1)
+        XCTAssertEqual(transactions, 1)
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
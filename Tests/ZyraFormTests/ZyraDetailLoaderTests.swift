@@ -0,0 +1,129 @@
+//
+//  ZyraDetailLoaderTests.swift
+//  ZyraFormTests
+//
+//  Batched on-demand detail columns and writes from list-projected models
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+/// Benchmark rows read through a list projection that leaves `description` out
+struct ListedTask: ZyraModel {
+    static let schema = ZyraTable(
+        name: "benchmark_tasks",
+        columns: [
+            zf.text("id").notNull(),
+            zf.text("user_id").notNull(),
+            zf.text("title").notNull(),
+            zf.text("description").nullable(),
+            zf.text("status").notNull(),
+            zf.integer("priority").notNull(),
+            zf.integer("estimate").nullable(),
+            zf.bool("is_completed").notNull(),
+            zf.bool("is_archived").notNull()
+        ],
+        listFields: ["user_id", "title", "status", "priority", "is_completed", "is_archived"]
+    )
+
+    var id: String
+    var title: String
+    var details: String?
+    var priority: Int
+
+    init(from record: [String: Any]) throws {
+        self.id = record["id"] as? String ?? ""
+        self.title = record["title"] as? String ?? ""
+        self.details = record["description"] as? String
+        self.priority = record["priority"] as? Int ?? 0
+    }
+
+    func toDictionary(excluding columns: [String] = []) -> [String: Any] {
+        var dict: [String: Any] = ["id": id, "title": title, "description": details as Any, "priority": priority]
+        for column in columns {
+            dict.removeValue(forKey: column)
+        }
+        return dict
+    }
+}
+
+@MainActor
+final class ZyraDetailLoaderTests: XCTestCase {
+    private func insert(_ descriptions: [String], into service: ZyraSync) async throws -> [String] {
+        return try await service.createRecords(records: descriptions.enumerated().map { index, description in
+            [
+                "user_id": "user-1", "title": "Task \(index)", "description": description, "status": "active",
+                "priority": index, "is_completed": "false", "is_archived": "false"
+            ]
+        })
+    }
+
+    func testRequestsMadeTogetherShareOneQuery() async throws {
+        let database = ZyraTestDatabase.open("detail-batch")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let ids = try await insert(["First", "Second", "Third"], into: service)
+        let loader = ZyraDetailLoader(service: service, table: BenchmarkTask.schema, fields: ["description"])
+
+        // Started in one pass on the main actor, so all three join the same batch
+        let requests = ids.map { id in Task { try await loader.row(id: id, version: nil) } }
+        var descriptions: [String?] = []
+        for request in requests {
+            descriptions.append(try await request.value?.string("description"))
+        }
+
+        XCTAssertEqual(descriptions, ["First", "Second", "Third"])
+        XCTAssertEqual(loader.queryCount, 1)
+        XCTAssertEqual(loader.count, 3)
+
+        // Memoized for the same version, fetched again for another one
+        let memoized = try await loader.row(id: ids[0], version: nil)
+        XCTAssertEqual(memoized?.string("description"), "First")
+        XCTAssertEqual(loader.queryCount, 1)
+        _ = try await loader.row(id: ids[0], version: "another version")
+        XCTAssertEqual(loader.queryCount, 2)
+
+        let rows = try await loader.rows(ids: [ids[1], "missing"])
+        XCTAssertEqual(rows[ids[1]]?.string("description"), "Second")
+        XCTAssertNil(rows["missing"])
+        XCTAssertEqual(loader.queryCount, 3)
+
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testUpdatingAListedModelKeepsUnloadedColumns() async throws {
+        let database = ZyraTestDatabase.open("detail-writes")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let ids = try await insert(["Keep me", "Replace me"], into: service)
+
+        let typed = TypedZyraSync<ListedTask>(userId: "user-1", database: database)
+        try await typed.loadRecords(orderBy: "priority", timeout: 5)
+        XCTAssertNil(typed.records.first?.details)
+
+        // The listed model holds the fallback for `description`; it must not be written back
+        var renamed = typed.records[0]
+        renamed.title = "Renamed"
+        try await typed.updateRecord(renamed)
+
+        // A value the caller set is written
+        var replaced = typed.records[1]
+        replaced.details = "Replaced"
+        try await typed.updateRecords([replaced])
+
+        let stored = try await service.fetchRows(
+            fields: ["id", "title", "description"],
+            whereClause: nil,
+            orderBy: "priority"
+        )
+        XCTAssertEqual(stored.map { $0.string("id") }, ids)
+        XCTAssertEqual(stored.map { $0.string("title") }, ["Renamed", "Task 1"])
+        XCTAssertEqual(stored.map { $0.string("description") }, ["Keep me", "Replaced"])
+
+        let detailed = try await typed.detailed(typed.records[0])
+        XCTAssertEqual(detailed.details, "Keep me")
+
+        typed.stopWatching()
+        try await ZyraTestDatabase.close(database)
+    }
+}
@@ -0,0 +1,509 @@
+//
+//  ZyraFormBenchmarks.swift
+//  ZyraFormTests
+//
+//  Throughput benchmarks for the read/write hot paths
+//  Skipped unless ZYRA_BENCHMARKS is set
+//  Run with: ZYRA_BENCHMARKS=1 swift test -c release --filter ZyraFormBenchmarks
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+// MARK: - In-Memory Cursor
+
+/// SqlCursor over in-memory rows, positioned with `row`
+final class BenchmarkCursor: SqlCursor {
+    let columnNames: [String: Int]
+    let rows: [[Any?]]
+    var row = 0
+
+    init(columns: [String], rows: [[Any?]]) {
+        self.columnNames = Dictionary(uniqueKeysWithValues: columns.enumerated().map { ($1, $0) })
+        self.rows = rows
+    }
+
+    var columnCount: Int { columnNames.count }
+
+    private func index(_ name: String) throws -> Int {
+        guard let index = columnNames[name] else { throw SqlCursorError.columnNotFound(name) }
+        return index
+    }
+
+    private func value(_ index: Int) -> Any? { rows[row][index] }
+
+    func getBoolean(index: Int) throws -> Bool { try getBooleanOptional(index: index).orThrow(index) }
+    func getBooleanOptional(index: Int) -> Bool? { getIntOptional(index: index).map { $0 != 0 } }
+    func getBoolean(name: String) throws -> Bool { try getBoolean(index: index(name)) }
+    func getBooleanOptional(name: String) throws -> Bool? { getBooleanOptional(index: try index(name)) }
+
+    func getDouble(index: Int) throws -> Double { try getDoubleOptional(index: index).orThrow(index) }
+    func getDoubleOptional(index: Int) -> Double? {
+        switch value(index) {
+        case let v as Double: return v
+        case let v as Int: return Double(v)
+        case let v as String: return Double(v) ?? 0
+        default: return nil
+        }
+    }
+    func getDouble(name: String) throws -> Double { try getDouble(index: index(name)) }
+    func getDoubleOptional(name: String) throws -> Double? { getDoubleOptional(index: try index(name)) }
+
+    func getInt(index: Int) throws -> Int { try getIntOptional(index: index).orThrow(index) }
+    func getIntOptional(index: Int) -> Int? {
+        switch value(index) {
+        case let v as Int: return v
+        case let v as Double: return Int(v)
+        case let v as String: return Int(v) ?? 0
+        default: return nil
+        }
+    }
+    func getInt(name: String) throws -> Int { try getInt(index: index(name)) }
+    func getIntOptional(name: String) throws -> Int? { getIntOptional(index: try index(name)) }
+
+    func getInt64(index: Int) throws -> Int64 { Int64(try getInt(index: index)) }
+    func getInt64Optional(index: Int) -> Int64? { getIntOptional(index: index).map { Int64($0) } }
+    func getInt64(name: String) throws -> Int64 { try getInt64(index: index(name)) }
+    func getInt64Optional(name: String) throws -> Int64? { getInt64Optional(index: try index(name)) }
+
+    func getString(index: Int) throws -> String { try getStringOptional(index: index).orThrow(index) }
+    func getStringOptional(index: Int) -> String? {
+        switch value(index) {
+        case let v as String: return v
+        case let v?: return "\(v)"
+        default: return nil
+        }
+    }
+    func getString(name: String) throws -> String { try getString(index: index(name)) }
+    func getStringOptional(name: String) throws -> String? { getStringOptional(index: try index(name)) }
+}
+
+private extension Optional {
+    func orThrow(_ index: Int) throws -> Wrapped {
+        guard let value = self else { throw SqlCursorError.nullValueFound(String(index)) }
+        return value
+    }
+}
+
+// MARK: - Fixtures
+
+enum BenchmarkFixtures {
+    static let columns = [
+        "id", "user_id", "title", "description", "status", "priority",
+        "estimate", "is_completed", "is_archived", "created_at", "updated_at"
+    ]
+    static let integerFields = ["priority", "estimate"]
+    static let booleanFields = ["is_completed", "is_archived"]
+
+    static func rows(_ count: Int) -> [[Any?]] {
+        return (0..<count).map { i in
+            [
+                UUID().uuidString.lowercased(), "user-1", "Task \(i)",
+                i % 3 == 0 ? nil : "Description for task \(i)", "active", i % 5,
+                i * 10, i % 2 == 0 ? 1 : 0, "false",
+                "2025-01-01T00:00:00Z", "2025-01-02T00:00:00Z"
+            ]
+        }
+    }
+
+    /// Rows per second for `body` decoding every row of `cursor`
+    static func rowsPerSecond(_ cursor: BenchmarkCursor, _ body: (SqlCursor) -> [String: Any]) -> Double {
+        let start = CFAbsoluteTimeGetCurrent()
+        var decoded = 0
+        for row in 0..<cursor.rows.count {
+            cursor.row = row
+            decoded += body(cursor).count
+        }
+        let elapsed = CFAbsoluteTimeGetCurrent() - start
+        XCTAssertGreaterThan(decoded, 0)
+        return Double(cursor.rows.count) / elapsed
+    }
+
+    /// Resident memory of the test process, in bytes
+    static func residentMemory() -> Int {
+        #if canImport(Darwin)
+        var info = mach_task_basic_info()
+        var count = mach_msg_type_number_t(MemoryLayout<mach_task_basic_info>.size / MemoryLayout<natural_t>.size)
+        let result = withUnsafeMutablePointer(to: &info) {
+            $0.withMemoryRebound(to: integer_t.self, capacity: Int(count)) {
+                task_info(mach_task_self_, task_flavor_t(MACH_TASK_BASIC_INFO), $0, &count)
+            }
+        }
+        return result == KERN_SUCCESS ? Int(info.resident_size) : 0
+        #else
+        // statm: size resident shared ... (in pages)
+        guard let statm = try? String(contentsOfFile: "/proc/self/statm", encoding: .utf8) else { return 0 }
+        let fields = statm.split(separator: " ")
+        guard fields.count > 1, let pages = Int(fields[1]) else { return 0 }
+        return pages * Int(sysconf(Int32(_SC_PAGESIZE)))
+        #endif
+    }
+}
+
+// MARK: - Benchmark Model
+
+/// Model over the fixture columns, written the way `ZyraTable.generateSwiftModel` emits it
+struct BenchmarkTask: ZyraModel {
+    static let schema = ZyraTable(
+        name: "benchmark_tasks",
+        columns: [
+            zf.text("id").notNull(),
+            zf.text("user_id").notNull(),
+            zf.text("title").notNull(),
+            zf.text("description").nullable(),
+            zf.text("status").notNull(),
+            zf.integer("priority").notNull(),
+            zf.integer("estimate").nullable(),
+            zf.bool("is_completed").notNull(),
+            zf.bool("is_archived").notNull(),
+            zf.text("created_at").notNull(),
+            zf.text("updated_at").nullable()
+        ]
+    )
+
+    let id: String
+    let userId: String
+    let title: String
+    let description: String?
+    let status: String
+    let priority: Int
+    let estimate: Int?
+    let isCompleted: Bool
+    let isArchived: Bool
+    let createdAt: String
+    let updatedAt: String?
+
+    init(from record: [String: Any]) throws {
+        self.id = record["id"] as? String ?? ""
+        self.userId = record["user_id"] as? String ?? ""
+        self.title = record["title"] as? String ?? ""
+        self.description = record["description"] as? String
+        self.status = record["status"] as? String ?? ""
+        self.priority = record["priority"] as? Int ?? (record["priority"] as? String).flatMap { Int($0) } ?? 0
+        self.estimate = record["estimate"] as? Int ?? (record["estimate"] as? String).flatMap { Int($0) }
+        self.isCompleted = record["is_completed"] as? Bool ?? false
+        self.isArchived = record["is_archived"] as? Bool ?? false
+        self.createdAt = record["created_at"] as? String ?? ""
+        self.updatedAt = record["updated_at"] as? String
+    }
+
+    init(row: ZyraModelRow) throws {
+        self.id = row.string(0) ?? ""
+        self.userId = row.string(1) ?? ""
+        self.title = row.string(2) ?? ""
+        self.description = row.string(3)
+        self.status = row.string(4) ?? ""
+        self.priority = row.int(5) ?? 0
+        self.estimate = row.int(6)
+        self.isCompleted = row.bool(7) ?? false
+        self.isArchived = row.bool(8) ?? false
+        self.createdAt = row.string(9) ?? ""
+        self.updatedAt = row.string(10)
+    }
+}
+
+// MARK: - Decode Benchmarks
+
+final class ZyraFormBenchmarks: XCTestCase {
+    /// Benchmarks decode, encrypt and write far more rows than a plain `swift test` run should
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        guard ProcessInfo.processInfo.environment["ZYRA_BENCHMARKS"] != nil else {
+            throw XCTSkip("Set ZYRA_BENCHMARKS=1 to run benchmarks")
+        }
+    }
+
+    /// The per-row mapper used before decode plans: Array.contains per field and try/fail type probing
+    private func legacyMapper(
+        fieldsToRead: [String],
+        integerFields: [String],
+        booleanFields: [String]
+    ) -> (SqlCursor) -> [String: Any] {
+        return { cursor in
+            var dict: [String: Any] = [:]
+            for fieldName in fieldsToRead {
+                if integerFields.contains(fieldName) {
+                    dict[fieldName] = try? cursor.getIntOptional(name: fieldName)
+                } else if booleanFields.contains(fieldName) {
+                    if let intValue = try? cursor.getIntOptional(name: fieldName) {
+                        dict[fieldName] = intValue == 1
+                    } else if let strValue = try? cursor.getStringOptional(name: fieldName) {
+                        dict[fieldName] = strValue == "true" || strValue == "1"
+                    }
+                } else {
+                    if let strValue = try? cursor.getStringOptional(name: fieldName) {
+                        dict[fieldName] = strValue
+                    } else if let intValue = try? cursor.getIntOptional(name: fieldName) {
+                        dict[fieldName] = intValue
+                    } else if let doubleValue = try? cursor.getDoubleOptional(name: fieldName) {
+                        dict[fieldName] = doubleValue
+                    }
+                }
+            }
+            return dict
+        }
+    }
+
+    func testDecodePlanRowsPerSecond() {
+        let rowCount = 20_000
+        let cursor = BenchmarkCursor(columns: BenchmarkFixtures.columns, rows: BenchmarkFixtures.rows(rowCount))
+
+        let legacy = legacyMapper(
+            fieldsToRead: BenchmarkFixtures.columns,
+            integerFields: BenchmarkFixtures.integerFields,
+            booleanFields: BenchmarkFixtures.booleanFields
+        )
+        let decoder = ZyraRowDecoder(
+            plan: ZyraDecodePlan(
+                fields: BenchmarkFixtures.columns,
+                integerFields: BenchmarkFixtures.integerFields,
+                booleanFields: BenchmarkFixtures.booleanFields,
+                fieldsMatchSelectOrder: true
+            ),
+            userId: "user-1",
+            encryptionManager: .shared
+        )
+
+        // Warm up both paths once before timing
+        _ = BenchmarkFixtures.rowsPerSecond(cursor, legacy)
+        _ = BenchmarkFixtures.rowsPerSecond(cursor, decoder.decode)
+
+        let legacyRate = BenchmarkFixtures.rowsPerSecond(cursor, legacy)
+        let planRate = BenchmarkFixtures.rowsPerSecond(cursor, decoder.decode)
+
+        print("📊 [decode] \(rowCount) rows - legacy mapper: \(Int(legacyRate)) rows/s, decode plan: \(Int(planRate)) rows/s (\(String(format: "%.2f", planRate / legacyRate))x)")
+    }
+
+    func testParallelDecodeScaling() async throws {
+        let rowCount = 50_000
+        let encryptedFields = ["title", "description", "status"]
+        let encryption = SecureEncryptionManager.shared
+
+        // Encrypted table: the text columns hold per-user ciphertext
+        let titleIndex = BenchmarkFixtures.columns.firstIndex(of: "title")!
+        let descriptionIndex = BenchmarkFixtures.columns.firstIndex(of: "description")!
+        let statusIndex = BenchmarkFixtures.columns.firstIndex(of: "status")!
+        var rows = BenchmarkFixtures.rows(rowCount)
+        for row in rows.indices {
+            for index in [titleIndex, descriptionIndex, statusIndex] {
+                if let value = rows[row][index] as? String {
+                    rows[row][index] = try encryption.encrypt(value, for: "user-1")
+                }
+            }
+        }
+        let cursor = BenchmarkCursor(columns: BenchmarkFixtures.columns, rows: rows)
+
+        let plan = ZyraDecodePlan(
+            fields: BenchmarkFixtures.columns,
+            encryptedFields: encryptedFields,
+            integerFields: BenchmarkFixtures.integerFields,
+            booleanFields: BenchmarkFixtures.booleanFields,
+            fieldsMatchSelectOrder: true
+        )
+
+        var concurrencies = [1]
+        while concurrencies.last! * 2 <= ProcessInfo.processInfo.activeProcessorCount {
+            concurrencies.append(concurrencies.last! * 2)
+        }
+        if concurrencies.last! != ProcessInfo.processInfo.activeProcessorCount {
+            concurrencies.append(ProcessInfo.processInfo.activeProcessorCount)
+        }
+
+        var baseline: Double?
+        for concurrency in concurrencies {
+            // No decrypt cache, so every run pays for every decryption
+            let decoder = ZyraRowDecoder(plan: plan, userId: "user-1", encryptionManager: encryption)
+            let executor = ZyraDecodeExecutor(concurrency: concurrency)
+
+            let start = CFAbsoluteTimeGetCurrent()
+            var rawRows: [ZyraRawRow] = []
+            rawRows.reserveCapacity(rowCount)
+            for row in 0..<rowCount {
+                cursor.row = row
+                rawRows.append(decoder.read(cursor))
+            }
+            let decoded = await executor.decode(rawRows, with: decoder)
+            let elapsed = CFAbsoluteTimeGetCurrent() - start
+
+            XCTAssertEqual(decoded.count, rowCount)
+            XCTAssertEqual(decoded[1]["title"] as? String, "Task 1")
+
+            let rate = Double(rowCount) / elapsed
+            baseline = baseline ?? rate
+            print("📊 [parallel decode] \(rowCount) encrypted rows - \(concurrency) task(s): \(Int(rate)) rows/s (\(String(format: "%.2f", rate / baseline!))x)")
+        }
+    }
+
+    func testModelDecoderRowsPerSecond() throws {
+        let rowCount = 100_000
+        let cursor = BenchmarkCursor(columns: BenchmarkFixtures.columns, rows: BenchmarkFixtures.rows(rowCount))
+        XCTAssertEqual(BenchmarkTask.allFields, BenchmarkFixtures.columns)
+
+        // Rows as a watch emission hands them over: decoded in schema order
+        let decoder = ZyraRowDecoder(plan: BenchmarkTask.decodePlan(fieldsMatchSelectOrder: true), userId: "user-1", encryptionManager: .shared)
+        let rows: [ZyraRow] = (0..<rowCount).map { row in
+            cursor.row = row
+            return decoder.decodeRow(cursor)
+        }
+
+        func modelsPerSecond(_ body: () throws -> [BenchmarkTask]) rethrows -> Double {
+            let start = CFAbsoluteTimeGetCurrent()
+            let models = try body()
+            let elapsed = CFAbsoluteTimeGetCurrent() - start
+            XCTAssertEqual(models.filter { $0.isCompleted }.count, rowCount / 2)
+            return Double(rowCount) / elapsed
+        }
+
+        let differ = ZyraRowDiffer()
+        let initial = differ.apply(rows)
+        let viaDictionary = { try rows.map { try BenchmarkTask(from: $0.dictionary) } }
+        let direct = { try ZyraModelDecoder<BenchmarkTask>().apply(rows, changes: initial) }
+
+        // Both paths must build the same model
+        let fromDictionary = try BenchmarkTask(from: rows[3].dictionary)
+        let fromRow = try direct()[3]
+        XCTAssertEqual(fromDictionary.description, fromRow.description)
+        XCTAssertEqual(fromDictionary.estimate, fromRow.estimate)
+        XCTAssertEqual(fromDictionary.isArchived, fromRow.isArchived)
+
+        // Warm up both paths once before timing
+        _ = try modelsPerSecond(viaDictionary)
+        _ = try modelsPerSecond(direct)
+
+        let dictionaryRate = try modelsPerSecond(viaDictionary)
+        let directRate = try modelsPerSecond(direct)
+
+        // Next emission with one row edited: only that row is built again
+        let models = ZyraModelDecoder<BenchmarkTask>()
+        _ = try models.apply(rows, changes: initial)
+        var edited = rows
+        edited[7].set("title", to: "Edited")
+        let changes = differ.apply(edited)
+        let incrementalRate = try modelsPerSecond { try models.apply(edited, changes: changes) }
+        XCTAssertEqual(changes.changedIds.count, 1)
+
+        print("📊 [model decode] \(rowCount) rows - via dictionary: \(Int(dictionaryRate)) rows/s, ZyraModelDecoder: \(Int(directRate)) rows/s (\(String(format: "%.2f", directRate / dictionaryRate))x), one row changed: \(Int(incrementalRate)) rows/s")
+    }
+
+    func testResidentMemoryPer10kRows() throws {
+        let rowCount = 100_000
+        let cursor = BenchmarkCursor(columns: BenchmarkFixtures.columns, rows: BenchmarkFixtures.rows(rowCount))
+        let decoder = ZyraRowDecoder(
+            plan: ZyraDecodePlan(
+                fields: BenchmarkFixtures.columns,
+                integerFields: BenchmarkFixtures.integerFields,
+                booleanFields: BenchmarkFixtures.booleanFields,
+                fieldsMatchSelectOrder: true
+            ),
+            userId: "user-1",
+            encryptionManager: .shared
+        )
+
+        // Both result sets stay alive, so freed pages cannot hide either measurement
+        let baseline = BenchmarkFixtures.residentMemory()
+        var dictionaries: [[String: Any]] = []
+        dictionaries.reserveCapacity(rowCount)
+        for row in 0..<rowCount {
+            cursor.row = row
+            dictionaries.append(decoder.decode(cursor))
+        }
+        let afterDictionaries = BenchmarkFixtures.residentMemory()
+
+        var rows: [ZyraRow] = []
+        rows.reserveCapacity(rowCount)
+        for row in 0..<rowCount {
+            cursor.row = row
+            rows.append(decoder.decodeRow(cursor))
+        }
+        let afterRows = BenchmarkFixtures.residentMemory()
+
+        XCTAssertEqual(rows[7]["title"] as? String, dictionaries[7]["title"] as? String)
+        XCTAssertEqual(rows[7]["is_completed"] as? Bool, dictionaries[7]["is_completed"] as? Bool)
+
+        let per10k = { (bytes: Int) in Double(bytes) / Double(rowCount / 10_000) / 1_048_576 }
+        let dictionaryMB = per10k(afterDictionaries - baseline)
+        let rowMB = per10k(afterRows - afterDictionaries)
+        print("📊 [row memory] resident per 10k rows - [String: Any]: \(String(format: "%.2f", dictionaryMB)) MB, ZyraRow: \(String(format: "%.2f", rowMB)) MB")
+
+        withExtendedLifetime((dictionaries, rows)) {}
+    }
+
+    func testTimestampThroughput() {
+        let count = 200_000
+        let formatter = ISO8601DateFormatter()
+        let dates = (0..<count).map { Date(timeIntervalSince1970: 1_700_000_000 + TimeInterval($0) * 37) }
+        let strings = dates.map { formatter.string(from: $0) }
+
+        func perSecond(_ body: () -> Int) -> Double {
+            let start = CFAbsoluteTimeGetCurrent()
+            XCTAssertEqual(body(), count)
+            return Double(count) / (CFAbsoluteTimeGetCurrent() - start)
+        }
+
+        let formatPerCall = perSecond { dates.reduce(0) { count, date in count + (ISO8601DateFormatter().string(from: date).isEmpty ? 0 : 1) } }
+        let formatShared = perSecond { dates.reduce(0) { count, date in count + (formatter.string(from: date).isEmpty ? 0 : 1) } }
+        let formatFast = perSecond { dates.reduce(0) { count, date in count + (ZyraTimestamp.string(from: date).isEmpty ? 0 : 1) } }
+
+        let parsePerCall = perSecond { strings.reduce(0) { count, text in count + (ISO8601DateFormatter().date(from: text) == nil ? 0 : 1) } }
+        let parseShared = perSecond { strings.reduce(0) { count, text in count + (formatter.date(from: text) == nil ? 0 : 1) } }
+        let parseFast = perSecond { strings.reduce(0) { count, text in count + (ZyraTimestamp.date(from: text) == nil ? 0 : 1) } }
+
+        print("📊 [timestamp format] \(count) dates - new formatter per call: \(Int(formatPerCall))/s, shared formatter: \(Int(formatShared))/s, ZyraTimestamp: \(Int(formatFast))/s")
+        print("📊 [timestamp parse] \(count) strings - new formatter per call: \(Int(parsePerCall))/s, shared formatter: \(Int(parseShared))/s, ZyraTimestamp: \(Int(parseFast))/s")
+    }
+
+    // MARK: - Write Benchmarks
+
+    /// Inserts ~111k rows; run with: ZYRA_BENCHMARKS=1 swift test -c release --filter testBatchedCreateRowsPerSecond
+    @MainActor
+    func testBatchedCreateRowsPerSecond() async throws {
+        let table = BenchmarkTask.schema
+        let database = PowerSyncDatabase(
+            schema: PowerSync.Schema(tables: [table.toPowerSyncTable()]),
+            dbFilename: "zyra-benchmark-\(UUID().uuidString).db"
+        )
+        let service = ZyraSync(tableName: table.name, userId: "user-1", database: database)
+        let encryptedFields = ["title", "description"]
+
+        func records(_ count: Int) -> [[String: Any]] {
+            return (0..<count).map { i in
+                [
+                    "user_id": "user-1", "title": "Task \(i)", "description": "Description for task \(i)",
+                    "status": "active", "priority": i % 5, "estimate": i * 10,
+                    "is_completed": false, "is_archived": false
+                ]
+            }
+        }
+
+        // Baseline: one implicit transaction per record
+        let single = records(1_000)
+        var start = CFAbsoluteTimeGetCurrent()
+        for record in single {
+            _ = try await service.createRecord(fields: record, encryptedFields: encryptedFields)
+        }
+        let singleRate = Double(single.count) / (CFAbsoluteTimeGetCurrent() - start)
+        print("📊 [create] 1000 rows - one execute per row: \(Int(singleRate)) rows/s")
+
+        var total = single.count
+        for count in [1_000, 10_000, 100_000] {
+            let batch = records(count)
+            start = CFAbsoluteTimeGetCurrent()
+            let ids = try await service.createRecords(records: batch, encryptedFields: encryptedFields)
+            let rate = Double(count) / (CFAbsoluteTimeGetCurrent() - start)
+            total += count
+
+            XCTAssertEqual(ids.count, count)
+            print("📊 [create] \(count) rows - batched, one transaction: \(Int(rate)) rows/s (\(String(format: "%.1f", rate / singleRate))x)")
+        }
+
+        let stored = try await database.getAll(sql: "SELECT COUNT(*) FROM \"\(table.name)\"", parameters: [], mapper: { cursor in
+            cursor.getIntOptional(index: 0) ?? 0
+        })
+        XCTAssertEqual(stored.first, total)
+
+        try await database.disconnectAndClear()
+        try await database.close()
+    }
+}
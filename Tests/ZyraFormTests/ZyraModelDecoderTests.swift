@@ -0,0 +1,78 @@
+//
+//  ZyraModelDecoderTests.swift
+//  ZyraFormTests
+//
+//  Typed models built per emission from decoded rows and their change sets
+//
+
+import Foundation
+import XCTest
+import ZyraForm
+
+final class ZyraModelDecoderTests: XCTestCase {
+    private let layout = ZyraRowLayout(names: BenchmarkTask.schema.fieldConfig.allFields)
+
+    private func task(_ id: String, title: String, priority: Int = 0, updatedAt: String = "2025-01-01T00:00:00Z") -> ZyraRow {
+        return ZyraRow(layout: layout, dictionary: [
+            "id": id, "user_id": "user-1", "title": title, "status": "active", "priority": priority,
+            "is_completed": true, "is_archived": false, "created_at": "2025-01-01T00:00:00Z", "updated_at": updatedAt
+        ])
+    }
+
+    func testDecodedRowReadsByOrdinal() throws {
+        let model = try BenchmarkTask(row: ZyraModelRow(row: task("a", title: "Write tests", priority: 3)))
+
+        XCTAssertEqual(model.id, "a")
+        XCTAssertEqual(model.title, "Write tests")
+        XCTAssertEqual(model.priority, 3)
+        XCTAssertNil(model.estimate)
+        XCTAssertTrue(model.isCompleted)
+        XCTAssertFalse(model.isArchived)
+    }
+
+    func testOnlyChangedRowsAreBuiltAgain() throws {
+        let differ = ZyraRowDiffer()
+        let decoder = ZyraModelDecoder<BenchmarkTask>()
+
+        let first = [task("a", title: "A"), task("b", title: "B")]
+        let initial = try decoder.apply(first, changes: differ.apply(first))
+        XCTAssertEqual(initial.map { $0.title }, ["A", "B"])
+
+        // Same `updated_at`, new title: the differ names "a" as updated, so its model is rebuilt
+        let second = [task("b", title: "B"), task("a", title: "A2"), task("c", title: "C")]
+        let models = try decoder.apply(second, changes: differ.apply(second))
+        XCTAssertEqual(models.map { $0.title }, ["B", "A2", "C"])
+        XCTAssertEqual(decoder.committedIds, ["b", "a", "c"])
+    }
+
+    func testRowsOutsideTheChangeSetKeepTheirModel() throws {
+        let decoder = ZyraModelDecoder<BenchmarkTask>()
+        let first = [task("a", title: "A")]
+        _ = try decoder.apply(first, changes: ZyraRowDiffer().apply(first))
+
+        // A change set that does not name "a" means its previous model is reused as-is
+        let unchanged = ZyraRowDiffer()
+        _ = unchanged.apply([task("a", title: "ignored")])
+        let changes = unchanged.apply([task("a", title: "ignored")])
+        let models = try decoder.apply([task("a", title: "ignored")], changes: changes)
+
+        XCTAssertTrue(changes.isEmpty)
+        XCTAssertEqual(models.first?.title, "A")
+    }
+
+    func testResetBuildsEveryRowAndTracksVersions() throws {
+        let decoder = ZyraModelDecoder<BenchmarkTask>()
+        let rows = [task("a", title: "A", updatedAt: "v1")]
+        _ = try decoder.apply(rows, changes: ZyraRowDiffer().apply(rows))
+        XCTAssertEqual(decoder.version(of: "a"), "v1")
+
+        let replaced = [task("a", title: "A2", updatedAt: "v2")]
+        let models = try decoder.apply(replaced, changes: ZyraRowDiffer().apply(replaced))
+        XCTAssertEqual(models.first?.title, "A2")
+        XCTAssertEqual(decoder.version(of: "a"), "v2")
+
+        decoder.reset()
+        XCTAssertNil(decoder.version(of: "a"))
+        XCTAssertEqual(decoder.committedIds, [])
+    }
+}
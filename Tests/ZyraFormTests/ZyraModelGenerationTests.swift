@@ -0,0 +1,34 @@
+//
+//  ZyraModelGenerationTests.swift
+//  ZyraFormTests
+//
+//  Generated `init(row:)` fallbacks for enum columns
+//
+
+import Foundation
+import XCTest
+import ZyraForm
+
+final class ZyraModelGenerationTests: XCTestCase {
+    private let priority = ZyraEnum(name: "task_priority", values: ["low", "high-ish"])
+
+    func testNonNullableEnumFallsBackToACase() {
+        let table = ZyraTable(
+            name: "generated_tasks",
+            columns: [
+                zf.text("id").notNull(),
+                zf.text("priority").enum(priority).notNull().default("high-ish"),
+                zf.text("fallback_priority").enum(priority).notNull(),
+                zf.text("unknown_priority").enum(priority).notNull().default("urgent"),
+                zf.text("optional_priority").enum(priority).nullable()
+            ]
+        )
+
+        let code = table.generateSwiftModel()
+
+        XCTAssertTrue(code.contains("self.priority = row.string(1).flatMap { TaskPriority(rawValue: $0) } ?? .high_ish"))
+        XCTAssertTrue(code.contains("self.fallbackPriority = row.string(2).flatMap { TaskPriority(rawValue: $0) } ?? .low"))
+        XCTAssertTrue(code.contains("self.unknownPriority = row.string(3).flatMap { TaskPriority(rawValue: $0) } ?? .low"))
+        XCTAssertTrue(code.contains("self.optionalPriority = row.string(4).flatMap { TaskPriority(rawValue: $0) }\n"))
+    }
+}
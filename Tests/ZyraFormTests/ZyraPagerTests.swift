@@ -0,0 +1,70 @@
+//
+//  ZyraPagerTests.swift
+//  ZyraFormTests
+//
+//  Keyset page windows over a watched query
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraPagerTests: XCTestCase {
+    private func insert(_ count: Int, into service: ZyraSync) async throws -> [String] {
+        return try await service.createRecords(records: (0..<count).map { i in
+            [
+                "user_id": "user-1", "title": "Task \(i)", "status": "active", "priority": i,
+                "is_completed": i % 2 == 0 ? "true" : "false", "is_archived": "false"
+            ]
+        })
+    }
+
+    func testWindowsMoveForwardAndBack() async throws {
+        let database = ZyraTestDatabase.open("pager-windows")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        _ = try await insert(7, into: service)
+
+        let pager = service.pager(query: BenchmarkTask.query().orderBy("priority"), pageSize: 3)
+        try await pager.start(timeout: 5)
+        XCTAssertEqual(pager.rows.map { $0.value("priority").intValue }, [0, 1, 2])
+        XCTAssertTrue(pager.hasNextPage)
+        XCTAssertFalse(pager.hasPreviousPage)
+
+        try await pager.nextPage(timeout: 5)
+        XCTAssertEqual(pager.rows.map { $0.value("priority").intValue }, [3, 4, 5])
+        XCTAssertTrue(pager.hasPreviousPage)
+
+        try await pager.nextPage(timeout: 5)
+        XCTAssertEqual(pager.rows.map { $0.value("priority").intValue }, [6])
+        XCTAssertFalse(pager.hasNextPage)
+
+        try await pager.previousPage(timeout: 5)
+        XCTAssertEqual(pager.rows.map { $0.value("priority").intValue }, [3, 4, 5])
+
+        pager.stop()
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testBooleanSortColumnPagesThroughEveryRowOnce() async throws {
+        let database = ZyraTestDatabase.open("pager-bool")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let ids = try await insert(5, into: service)
+
+        // Decoded cursors hold Bools; the window must compare them with the stored "true"/"false" text
+        let pager = service.pager(query: BenchmarkTask.query().orderBy("is_completed"), pageSize: 2)
+        try await pager.start(timeout: 5)
+        var seen = pager.rows.compactMap { $0.string("id") }
+        while pager.hasNextPage {
+            try await pager.nextPage(timeout: 5)
+            seen += pager.rows.compactMap { $0.string("id") }
+        }
+
+        XCTAssertEqual(seen.count, ids.count)
+        XCTAssertEqual(Set(seen), Set(ids))
+
+        pager.stop()
+        try await ZyraTestDatabase.close(database)
+    }
+}
@@ -0,0 +1,37 @@
+//
+//  ZyraQueryCacheTests.swift
+//  ZyraFormTests
+//
+//  Compiled query shapes shared per table, within a fixed capacity
+//
+
+import Foundation
+import XCTest
+import ZyraForm
+
+final class ZyraQueryCacheTests: XCTestCase {
+    func testSameShapeCompilesOnce() throws {
+        let table = ZyraTable(name: "cached_tasks", columns: [zf.text("id").notNull(), zf.text("title").notNull()])
+
+        let first = try table.query().where("title", equals: "a").compile()
+        let cached = table.queryCache.count
+        let second = try table.query().where("title", equals: "b").compile()
+
+        XCTAssertEqual(first.sql, second.sql)
+        XCTAssertEqual(table.queryCache.count, cached)
+    }
+
+    func testInListSizesStayWithinCapacity() throws {
+        let table = ZyraTable(name: "cached_tasks", columns: [zf.text("id").notNull(), zf.text("title").notNull()])
+        let capacity = table.queryCache.capacity
+
+        // Every IN-list size is its own shape
+        for count in 1...(capacity * 2 + 1) {
+            _ = try table.query().whereIn("id", Array(repeating: "x", count: count)).compile()
+            XCTAssertLessThanOrEqual(table.queryCache.count, capacity)
+        }
+
+        let pair = try table.query().whereIn("id", ["a", "b"]).compile()
+        XCTAssertTrue(pair.sql.contains("\"id\" IN (?, ?)"))
+    }
+}
@@ -0,0 +1,64 @@
+//
+//  ZyraRowTests.swift
+//  ZyraFormTests
+//
+//  Dictionary view of compact rows and the published records of a service
+//
+
+import Foundation
+import Combine
+import XCTest
+import ZyraForm
+
+final class ZyraRowTests: XCTestCase {
+    func testDictionaryKeepsExplicitNulls() {
+        let layout = ZyraRowLayout(names: ["id", "title", "estimate"])
+        let row = ZyraRow(layout: layout, values: [.text("a"), .null, .integer(3)])
+
+        let dictionary = row.dictionary
+        XCTAssertEqual(dictionary["id"] as? String, "a")
+        XCTAssertTrue(dictionary["title"] is NSNull)
+        XCTAssertEqual(dictionary["estimate"] as? Int, 3)
+
+        // Round trip: NSNull reads back as null
+        let copy = ZyraRow(layout: layout, dictionary: dictionary)
+        XCTAssertEqual(copy, row)
+        XCTAssertTrue(copy.value("title").isNull)
+    }
+
+    @MainActor
+    func testRecordsArePublishedAndSettable() async throws {
+        let database = ZyraTestDatabase.open("records")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+
+        var published: [[[String: Any]]] = []
+        let cancellable = service.$records.sink { published.append($0) }
+
+        service.records = [["id": "a", "title": "Draft"], ["id": "b", "title": NSNull()]]
+
+        XCTAssertEqual(service.rows.count, 2)
+        XCTAssertEqual(service.rows.first?.string("title"), "Draft")
+        XCTAssertTrue(service.rows.last?.value("title").isNull ?? false)
+        XCTAssertEqual(published.last?.count, 2)
+
+        cancellable.cancel()
+        try await ZyraTestDatabase.close(database)
+    }
+
+    @MainActor
+    func testWatchPublishesClearedColumnsAsNull() async throws {
+        let database = ZyraTestDatabase.open("records-watch")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let ids = try await ZyraTestDatabase.insertTasks(["One", "Two"], into: service)
+
+        try await service.loadRecords(fields: ["id", "title", "priority"], orderBy: "priority", timeout: 5)
+        XCTAssertEqual(service.records.map { $0["title"] as? String }, ["One", "Two"])
+
+        try await service.updateRecord(id: ids[1], fields: ["title": NSNull()])
+        try await ZyraTestDatabase.waitUntil { service.records.last?["title"] is NSNull }
+        XCTAssertEqual(service.records.first?["title"] as? String, "One")
+
+        service.stopWatching()
+        try await ZyraTestDatabase.close(database)
+    }
+}
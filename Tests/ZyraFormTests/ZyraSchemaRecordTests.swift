@@ -0,0 +1,51 @@
+//
+//  ZyraSchemaRecordTests.swift
+//  ZyraFormTests
+//
+//  Null columns of schema records: cleared when loaded or set, left alone otherwise
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+final class ZyraSchemaRecordTests: XCTestCase {
+    func testOnlyPresentColumnsAreWrittenAsNull() {
+        let record = SchemaRecord(schema: BenchmarkTask.schema, data: ["id": "a", "title": "Draft", "estimate": NSNull()])
+        let cleared = record.setting("description", to: NSNull())
+
+        let dictionary = cleared.toDictionary()
+        XCTAssertEqual(dictionary["title"] as? String, "Draft")
+        XCTAssertTrue(dictionary["estimate"] is NSNull)
+        XCTAssertTrue(dictionary["description"] is NSNull)
+        XCTAssertNil(dictionary["status"])
+        XCTAssertEqual(cleared.presentColumns, ["id", "title", "estimate", "description"])
+    }
+
+    @MainActor
+    func testUpdateRecordClearsLoadedColumns() async throws {
+        let database = ZyraTestDatabase.open("schema-record-null")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let id = try await service.createRecord(fields: [
+            "user_id": "user-1", "title": "Draft", "description": "Notes", "estimate": 5,
+            "status": "active", "priority": 0, "is_completed": "false", "is_archived": "false"
+        ])
+        let sync = SchemaBasedSync(schema: BenchmarkTask.schema, userId: "user-1", database: database, watchForUpdates: false)
+
+        // A loaded record with a column cleared writes NULL
+        let loaded = try await sync.getOne(id: id)
+        let cleared = try XCTUnwrap(loaded).setting("description", to: NSNull())
+        try await sync.updateRecord(cleared)
+
+        // A record built from a few fields leaves the others alone
+        try await sync.updateRecord(SchemaRecord(schema: BenchmarkTask.schema, data: ["id": id, "title": "Renamed"]))
+
+        let stored = try await service.fetchRows(fields: ["title", "description", "estimate"], orderBy: "priority", integerFields: ["estimate"])
+        XCTAssertEqual(stored.first?.string("title"), "Renamed")
+        XCTAssertTrue(stored.first?.value("description").isNull ?? false)
+        XCTAssertEqual(stored.first?.value("estimate").intValue, 5)
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
@@ -0,0 +1,88 @@
+//
+//  ZyraSearchTests.swift
+//  ZyraFormTests
+//
+//  FTS5 index statements and match expressions for searchable columns
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+final class ZyraSearchTests: XCTestCase {
+    func testSearchIndexCoversPlainSearchableColumns() {
+        let notes = ZyraTable(name: "notes", columns: [
+            zf.text("title").searchable(),
+            zf.text("body").searchable().nullable(),
+            zf.text("secret").encrypted().searchable()
+        ])
+        XCTAssertEqual(notes.searchableFields, ["title", "body"])
+
+        let statements = notes.searchIndexStatements()
+        XCTAssertEqual(statements.count, 4)
+        XCTAssertTrue(statements[0].contains("USING fts5(\"id\" UNINDEXED, \"title\", \"body\""))
+        XCTAssertTrue(statements[1].contains("AFTER INSERT ON \"ps_data__notes\""))
+        XCTAssertTrue(statements[1].contains("json_extract(NEW.data, '$.title')"))
+
+        // User input becomes quoted prefix terms, so FTS5 syntax in it is matched literally
+        XCTAssertEqual(ZyraSearch.matchExpression(for: " quarterly  \"rep\" OR"), "\"quarterly\"* \"\"\"rep\"\"\"* \"OR\"*")
+        XCTAssertNil(ZyraSearch.matchExpression(for: "   "))
+    }
+
+    @MainActor
+    func testIndexFollowsLocalWritesAndSyncApplies() async throws {
+        let notes = ZyraTable(name: "search_notes", columns: [
+            zf.text("id").notNull(),
+            zf.text("title").searchable().notNull(),
+            zf.text("body").searchable().nullable()
+        ])
+        let schema = ZyraSchema(tables: [notes])
+        let database = PowerSyncDatabase(schema: schema.toPowerSyncSchema(), dbFilename: "zyra-search-\(UUID().uuidString).db")
+        try await schema.installSearchIndexes(on: database)
+        let service = ZyraSync(tableName: notes.name, userId: "user-1", database: database)
+
+        func titles(_ text: String) async throws -> [String] {
+            return try await service.searchRows(text, query: notes.query()).compactMap { $0.string("title") }.sorted()
+        }
+        func indexRows() async throws -> Int {
+            let count = try await database.getAll(sql: "SELECT COUNT(*) FROM \"\(notes.searchIndexName)\"", parameters: [], mapper: { cursor in
+                cursor.getIntOptional(index: 0) ?? 0
+            })
+            return count.first ?? 0
+        }
+
+        let ids = try await service.createRecords(records: [
+            ["title": "Quarterly report", "body": "Numbers"],
+            ["title": "Team offsite", "body": "Agenda for the quarter"]
+        ], autoTimestamp: false)
+        var found = try await titles("quart")
+        XCTAssertEqual(found, ["Quarterly report", "Team offsite"])
+
+        try await service.updateRecord(id: ids[0], fields: ["title": "Annual report"], autoTimestamp: false)
+        found = try await titles("quart")
+        XCTAssertEqual(found, ["Team offsite"])
+        found = try await titles("annual")
+        XCTAssertEqual(found, ["Annual report"])
+
+        try await service.deleteRecords(ids: [ids[1]])
+        found = try await titles("quart")
+        XCTAssertEqual(found, [])
+
+        // A sync apply replaces the storage row: no delete trigger fires and the rowid may change
+        for title in ["Synced title", "Synced again"] {
+            try await database.execute(
+                sql: "INSERT OR REPLACE INTO \"ps_data__\(notes.name)\"(id, data) VALUES (?, json_object('title', ?, 'body', 'Replaced'))",
+                parameters: [ids[0], title]
+            )
+        }
+        found = try await titles("annual")
+        XCTAssertEqual(found, [])
+        found = try await titles("synced")
+        XCTAssertEqual(found, ["Synced again"])
+        let remaining = try await indexRows()
+        XCTAssertEqual(remaining, 1)
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
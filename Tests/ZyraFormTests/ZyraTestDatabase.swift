@@ -0,0 +1,56 @@
+//
+//  ZyraTestDatabase.swift
+//  ZyraFormTests
+//
+//  Throwaway PowerSync databases and polling helpers for tests against a real watch
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+enum ZyraTestDatabase {
+    /// A fresh on-disk database holding the benchmark table
+    static func open(_ name: String) -> PowerSyncDatabaseProtocol {
+        return PowerSyncDatabase(
+            schema: PowerSync.Schema(tables: [BenchmarkTask.schema.toPowerSyncTable()]),
+            dbFilename: "zyra-\(name)-\(UUID().uuidString).db"
+        )
+    }
+
+    /// Delete the database's data and close it
+    static func close(_ database: PowerSyncDatabaseProtocol) async throws {
+        try await database.disconnectAndClear()
+        try await database.close()
+    }
+
+    /// Insert plain benchmark rows; returns their ids in order
+    @MainActor
+    static func insertTasks(_ titles: [String], into service: ZyraSync) async throws -> [String] {
+        return try await service.createRecords(records: titles.enumerated().map { index, title in
+            [
+                "user_id": "user-1", "title": title, "status": "active", "priority": index,
+                "is_completed": false, "is_archived": false
+            ]
+        })
+    }
+
+    /// Poll `condition` on the main actor until it holds
+    @MainActor
+    static func waitUntil(
+        timeout: TimeInterval = 5,
+        file: StaticString = #filePath,
+        line: UInt = #line,
+        _ condition: () -> Bool
+    ) async throws {
+        let deadline = Date().addingTimeInterval(timeout)
+        while !condition() {
+            guard Date() < deadline else {
+                XCTFail("Condition not met within \(timeout) seconds", file: file, line: line)
+                return
+            }
+            try await Task.sleep(nanoseconds: 10_000_000)
+        }
+    }
+}
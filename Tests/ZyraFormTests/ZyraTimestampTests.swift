@@ -0,0 +1,49 @@
+//
+//  ZyraTimestampTests.swift
+//  ZyraFormTests
+//
+//  ISO 8601 formatting and parsing against ISO8601DateFormatter
+//
+
+import Foundation
+import XCTest
+import ZyraForm
+
+final class ZyraTimestampTests: XCTestCase {
+    func testConformsToISO8601DateFormatter() {
+        let formatter = ISO8601DateFormatter()
+        let fractionalFormatter = ISO8601DateFormatter()
+        fractionalFormatter.formatOptions = [.withInternetDateTime, .withFractionalSeconds]
+
+        // Whole seconds across leap years, century boundaries and pre-1970 dates
+        var generator = SystemRandomNumberGenerator()
+        var samples: [TimeInterval] = [0, -1, 951_782_400, 4_107_542_399, -2_208_988_800, 1_709_164_800]
+        for _ in 0..<10_000 {
+            samples.append(TimeInterval(Int.random(in: -2_000_000_000...4_000_000_000, using: &generator)))
+        }
+
+        for seconds in samples {
+            let date = Date(timeIntervalSince1970: seconds)
+            let expected = formatter.string(from: date)
+            XCTAssertEqual(ZyraTimestamp.string(from: date), expected)
+            XCTAssertEqual(ZyraTimestamp.date(from: expected), formatter.date(from: expected))
+
+            let fractional = fractionalFormatter.string(from: date.addingTimeInterval(0.25))
+            XCTAssertEqual(
+                ZyraTimestamp.date(from: fractional)?.timeIntervalSince1970 ?? .nan,
+                fractionalFormatter.date(from: fractional)?.timeIntervalSince1970 ?? .nan,
+                accuracy: 0.001
+            )
+        }
+
+        // Offsets and the Postgres text form
+        XCTAssertEqual(ZyraTimestamp.date(from: "2025-01-02T03:04:05+02:00"), formatter.date(from: "2025-01-02T01:04:05Z"))
+        XCTAssertEqual(ZyraTimestamp.date(from: "2025-01-02 03:04:05.5-0130")?.timeIntervalSince1970, formatter.date(from: "2025-01-02T04:34:05Z").map { $0.timeIntervalSince1970 + 0.5 })
+        XCTAssertEqual(ZyraTimestamp.date(from: "2025-01-02T03:04:05+00"), formatter.date(from: "2025-01-02T03:04:05Z"))
+
+        // Malformed or out-of-range values are rejected
+        for invalid in ["", "2025-01-02", "2025-13-01T00:00:00Z", "2025-02-29T00:00:00Z", "2025-01-02T24:00:00Z", "2025-01-02T03:04:05.Z", "2025-01-02T03:04:05Zjunk"] {
+            XCTAssertNil(ZyraTimestamp.date(from: invalid), invalid)
+        }
+    }
+}
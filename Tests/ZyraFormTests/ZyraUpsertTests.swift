@@ -0,0 +1,58 @@
+//
+//  ZyraUpsertTests.swift
+//  ZyraFormTests
+//
+//  Creating and updating records by id in one transaction
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraUpsertTests: XCTestCase {
+    private func task(_ id: String, title: String, priority: Int) -> [String: Any] {
+        return [
+            "id": id, "user_id": "user-1", "title": title, "status": "active", "priority": priority,
+            "is_completed": "false", "is_archived": "false"
+        ]
+    }
+
+    func testCreatesNewIdsAndUpdatesExistingOnes() async throws {
+        let database = ZyraTestDatabase.open("upsert")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let existing = try await service.createRecord(fields: ["user_id": "user-1", "title": "Existing", "priority": 0])
+        let before = try await service.fetchRows(fields: ["id", "created_at"], orderBy: "priority")
+        let existingCreatedAt = before.first?.string("created_at")
+
+        // Written with an uppercase id, before ids were canonicalized
+        let legacy = UUID().uuidString
+        try await database.execute(
+            sql: "INSERT INTO \"\(BenchmarkTask.schema.name)\" (id, user_id, title, status, priority, is_completed, is_archived, created_at, updated_at) VALUES (?, 'user-1', 'Legacy', 'active', 1, 'false', 'false', '2020-01-01T00:00:00Z', '2020-01-01T00:00:00Z')",
+            parameters: [legacy]
+        )
+
+        let fresh = UUID().uuidString.lowercased()
+        let ids = try await service.upsertRecords(records: [
+            ["id": existing.uppercased(), "title": "Existing, updated"],
+            ["id": legacy.lowercased(), "title": "Legacy, updated"],
+            task(fresh, title: "New", priority: 2),
+            // The same id again: the last record wins
+            task(fresh, title: "New, repeated", priority: 2)
+        ])
+        XCTAssertEqual(ids, [existing, legacy.lowercased(), fresh, fresh])
+
+        let rows = try await service.fetchRows(fields: ["id", "title", "created_at", "updated_at"], orderBy: "priority")
+        XCTAssertEqual(rows.map { $0.string("title") }, ["Existing, updated", "Legacy, updated", "New, repeated"])
+
+        // Updated in place: the legacy row keeps its stored id, and neither keeps a new created_at
+        XCTAssertEqual(rows.map { $0.string("id") }, [existing, legacy, fresh])
+        XCTAssertEqual(rows[0].string("created_at"), existingCreatedAt)
+        XCTAssertEqual(rows[1].string("created_at"), "2020-01-01T00:00:00Z")
+        XCTAssertNotEqual(rows[1].string("updated_at"), "2020-01-01T00:00:00Z")
+        XCTAssertNotNil(rows[2].string("created_at"))
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
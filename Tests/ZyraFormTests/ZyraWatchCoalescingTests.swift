@@ -0,0 +1,75 @@
+//
+//  ZyraWatchCoalescingTests.swift
+//  ZyraFormTests
+//
+//  Pacing and newest-only backpressure for bursts of watch emissions
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraWatchCoalescingTests: XCTestCase {
+    private let plan = ZyraDecodePlan(fields: ["id", "title"], fieldsMatchSelectOrder: true)
+    private let sql = "SELECT id, title FROM benchmark_tasks ORDER BY priority"
+
+    func testRateIsClampedToNonNegativeIntervals() {
+        XCTAssertEqual(ZyraWatchCoalescing.maxRate(10).minimumInterval, 0.1, accuracy: 1e-9)
+        XCTAssertEqual(ZyraWatchCoalescing.maxRate(0).minimumInterval, 0)
+        XCTAssertEqual(ZyraWatchCoalescing(minimumInterval: -1).minimumInterval, 0)
+        XCTAssertTrue(ZyraWatchCoalescing.default.dropsIntermediateSnapshots)
+    }
+
+    func testDifferentCoalescingDoesNotShareAWatch() async throws {
+        let database = ZyraTestDatabase.open("coalescing-key")
+        let hub = ZyraWatchHub()
+
+        let paced = hub.subscribe(
+            database: database, sql: sql, parameters: [], plan: plan, userId: "user-1",
+            encryptionManager: .shared, decryptCache: nil, coalescing: .maxRate(5), handler: { _ in }
+        )
+        let unpaced = hub.subscribe(
+            database: database, sql: sql, parameters: [], plan: plan, userId: "user-1",
+            encryptionManager: .shared, decryptCache: nil, coalescing: .default, handler: { _ in }
+        )
+        XCTAssertEqual(hub.activeWatchCount, 2)
+
+        paced.cancel()
+        unpaced.cancel()
+        try await ZyraTestDatabase.waitUntil { hub.activeWatchCount == 0 }
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testBurstOfWritesIsPublishedAsFewerSnapshots() async throws {
+        let database = ZyraTestDatabase.open("coalescing-burst")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let hub = ZyraWatchHub()
+        let burst = 50
+
+        var snapshots: [[ZyraRow]] = []
+        let subscription = hub.subscribe(
+            database: database, sql: sql, parameters: [], plan: plan, userId: "user-1",
+            encryptionManager: .shared, decryptCache: nil, coalescing: .maxRate(5)
+        ) { event in
+            if case .snapshot(let rows, _) = event { snapshots.append(rows) }
+        }
+        try await ZyraTestDatabase.waitUntil { !snapshots.isEmpty }
+
+        // One transaction per row, each of which would otherwise be its own emission
+        for i in 0..<burst {
+            _ = try await service.createRecord(fields: ["user_id": "user-1", "title": "Task \(i)", "priority": i])
+        }
+        try await ZyraTestDatabase.waitUntil { snapshots.last?.count == burst }
+
+        // The trailing snapshot always arrives, the ones in between collapse
+        XCTAssertEqual(snapshots.last?.last?.string("title"), "Task \(burst - 1)")
+        XCTAssertLessThan(snapshots.count, burst)
+        let statistics = subscription.statistics
+        XCTAssertLessThanOrEqual(statistics.published, statistics.received)
+
+        subscription.cancel()
+        try await ZyraTestDatabase.close(database)
+    }
+}
@@ -0,0 +1,102 @@
+//
+//  ZyraWatchHubTests.swift
+//  ZyraFormTests
+//
+//  Sharing, replay and teardown of reference-counted watches
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraWatchHubTests: XCTestCase {
+    private let plan = ZyraDecodePlan(fields: ["id", "title"], fieldsMatchSelectOrder: true)
+
+    private func subscribe(
+        _ hub: ZyraWatchHub,
+        _ database: PowerSyncDatabaseProtocol,
+        _ sql: String,
+        handler: @escaping (ZyraWatchHub.Event) -> Void = { _ in }
+    ) -> ZyraWatchSubscription {
+        return hub.subscribe(
+            database: database,
+            sql: sql,
+            parameters: [],
+            plan: plan,
+            userId: "user-1",
+            encryptionManager: .shared,
+            decryptCache: nil,
+            handler: handler
+        )
+    }
+
+    func testFormattingSharesOneWatchButQuotedTextDoesNot() async throws {
+        let database = ZyraTestDatabase.open("hub-sharing")
+        let hub = ZyraWatchHub()
+
+        let first = subscribe(hub, database, "SELECT id, title FROM benchmark_tasks WHERE title = 'a  b'")
+        let second = subscribe(hub, database, "SELECT id,   title\n  FROM benchmark_tasks WHERE title = 'a  b'")
+        XCTAssertEqual(hub.activeWatchCount, 1)
+        XCTAssertEqual(hub.subscriberCount, 2)
+
+        // Whitespace inside a literal is part of the query
+        let third = subscribe(hub, database, "SELECT id, title FROM benchmark_tasks WHERE title = 'a b'")
+        XCTAssertEqual(hub.activeWatchCount, 2)
+
+        first.cancel()
+        try await ZyraTestDatabase.waitUntil { hub.subscriberCount == 2 }
+        XCTAssertEqual(hub.activeWatchCount, 2)
+
+        // The last subscriber out stops the watch
+        second.cancel()
+        third.cancel()
+        try await ZyraTestDatabase.waitUntil { hub.activeWatchCount == 0 }
+
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testLateSubscriberStartsWithReset() async throws {
+        let database = ZyraTestDatabase.open("hub-replay")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        _ = try await ZyraTestDatabase.insertTasks(["One", "Two"], into: service)
+
+        let hub = ZyraWatchHub()
+        let sql = "SELECT id, title FROM benchmark_tasks ORDER BY priority"
+        var early: [ZyraChangeSet] = []
+        let first = subscribe(hub, database, sql) { event in
+            if case .snapshot(_, let changes) = event { early.append(changes) }
+        }
+        try await ZyraTestDatabase.waitUntil { !early.isEmpty }
+
+        var late: [([ZyraRow], ZyraChangeSet)] = []
+        let second = subscribe(hub, database, sql) { event in
+            if case .snapshot(let rows, let changes) = event { late.append((rows, changes)) }
+        }
+
+        // Replayed synchronously from the shared snapshot, without a new query
+        XCTAssertEqual(late.count, 1)
+        XCTAssertEqual(late.first?.0.map { $0.string("title") }, ["One", "Two"])
+        XCTAssertEqual(late.first?.1.isReset, true)
+        XCTAssertEqual(hub.activeWatchCount, 1)
+
+        first.cancel()
+        second.cancel()
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testFailedWatchIsNotReportedAsWatching() async throws {
+        let database = ZyraTestDatabase.open("hub-failure")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+
+        do {
+            try await service.loadRecordsWithRawSQL(sql: "SELECT id FROM missing_table", fieldsToRead: ["id"], timeout: 5)
+            XCTFail("Watching a missing table should fail")
+        } catch {
+            XCTAssertFalse(service.isWatching)
+        }
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
@@ -0,0 +1,79 @@
+//
+//  ZyraWriteBehindTests.swift
+//  ZyraFormTests
+//
+//  Coalesced autosave updates and what happens to them when the service goes away
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+@MainActor
+final class ZyraWriteBehindTests: XCTestCase {
+    private func storedTitle(_ id: String, in database: PowerSyncDatabaseProtocol) async throws -> String? {
+        let titles = try await database.getAll(
+            sql: "SELECT title FROM \"\(BenchmarkTask.schema.name)\" WHERE id = ?",
+            parameters: [id],
+            mapper: { cursor in cursor.getStringOptional(index: 0) }
+        )
+        return titles.first ?? nil
+    }
+
+    func testCoalescesAutosaveUpdates() async throws {
+        let database = ZyraTestDatabase.open("write-behind")
+        let service = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let id = try await service.createRecord(fields: ["user_id": "user-1", "title": "Draft", "priority": 0])
+
+        // An autosave tick per keystroke
+        service.writeBehind = ZyraWriteBehind(window: 60, flushesOnBackground: false)
+        for i in 1...200 {
+            try await service.updateRecord(id: id, fields: ["title": "Draft \(i)", "priority": i % 5])
+        }
+
+        XCTAssertEqual(service.pendingWriteCount, 1)
+        let before = try await storedTitle(id, in: database)
+        XCTAssertEqual(before, "Draft")
+
+        // Reads see the pending values before they are written
+        let read = try await service.fetchRecord(id: id, fields: ["id", "title", "priority"])
+        XCTAssertEqual(read?["title"] as? String, "Draft 200")
+
+        try await service.flushPendingWrites()
+        XCTAssertEqual(service.pendingWriteCount, 0)
+        let after = try await storedTitle(id, in: database)
+        XCTAssertEqual(after, "Draft 200")
+
+        // One CRUD entry for the insert, one for the 200 coalesced updates
+        let entries = try await database.getAll(sql: "SELECT COUNT(*) FROM ps_crud", parameters: [], mapper: { cursor in
+            cursor.getIntOptional(index: 0) ?? 0
+        })
+        XCTAssertEqual(entries.first, 2)
+
+        try await ZyraTestDatabase.close(database)
+    }
+
+    func testPendingUpdatesAreWrittenAfterTheServiceIsReleased() async throws {
+        let database = ZyraTestDatabase.open("write-behind-released")
+        var service: ZyraSync? = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let id = try await service!.createRecord(fields: ["user_id": "user-1", "title": "Draft", "priority": 0])
+
+        service!.writeBehind = ZyraWriteBehind(window: 60, flushesOnBackground: false)
+        try await service!.updateRecord(id: id, fields: ["title": "Last edit"])
+        XCTAssertEqual(service!.pendingWriteCount, 1)
+
+        // Released long before the window closes
+        service = nil
+
+        var title: String?
+        let deadline = Date().addingTimeInterval(5)
+        while title != "Last edit" && Date() < deadline {
+            try await Task.sleep(nanoseconds: 10_000_000)
+            title = try await storedTitle(id, in: database)
+        }
+        XCTAssertEqual(title, "Last edit")
+
+        try await ZyraTestDatabase.close(database)
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  ZyraWriteStatementsTests.swift
+//  ZyraFormTests
+//
+//  Column order per service and cached SQL text per table
+//
+
+import Foundation
+import XCTest
+import PowerSync
+import ZyraForm
+
+final class ZyraWriteStatementsTests: XCTestCase {
+    func testSchemaOrderAndStableSQL() {
+        let statements = ZyraWriteStatements.shared(for: "write_order_tasks")
+        let order = ZyraColumnOrder(["id", "title", "priority", "created_at", "updated_at"])
+
+        // Dictionary order must not leak into the SQL: schema columns first, unknown ones by name
+        let fields: [String: Any] = ["updated_at": "", "zeta": 1, "priority": 2, "alpha": 3, "title": "t"]
+        let columns = order.ordered(fields.keys)
+        XCTAssertEqual(columns, ["title", "priority", "updated_at", "alpha", "zeta"])
+        XCTAssertEqual(ZyraColumnOrder().ordered(fields.keys), ["alpha", "priority", "title", "updated_at", "zeta"])
+
+        let insert = statements.insertSQL(columns: ["id"] + columns, rowCount: 2)
+        XCTAssertEqual(insert, "INSERT INTO \"write_order_tasks\" (\"id\", \"title\", \"priority\", \"updated_at\", \"alpha\", \"zeta\") VALUES (?, ?, ?, ?, ?, ?), (?, ?, ?, ?, ?, ?)")
+        XCTAssertEqual(statements.updateSQL(columns: ["title", "updated_at"], idCount: 3), "UPDATE \"write_order_tasks\" SET \"title\" = ?, \"updated_at\" = ? WHERE id IN (?, ?, ?)")
+
+        // One cached string per shape
+        let cached = statements.count
+        XCTAssertEqual(statements.insertSQL(columns: ["id"] + columns, rowCount: 2), insert)
+        XCTAssertEqual(statements.count, cached)
+        XCTAssertTrue(ZyraWriteStatements.shared(for: "write_order_tasks") === statements)
+    }
+
+    func testCacheStaysWithinCapacity() {
+        let statements = ZyraWriteStatements.shared(for: "write_capacity_tasks")
+
+        // Every id count is its own shape
+        for idCount in 1...(statements.capacity * 2 + 1) {
+            XCTAssertTrue(statements.deleteSQL(idCount: idCount).hasSuffix("?)"))
+            XCTAssertLessThanOrEqual(statements.count, statements.capacity)
+        }
+        XCTAssertEqual(statements.deleteSQL(idCount: 2), "DELETE FROM \"write_capacity_tasks\" WHERE id IN (?, ?)")
+    }
+
+    @MainActor
+    func testColumnOrderIsPerService() async throws {
+        let database = ZyraTestDatabase.open("write-order")
+        let ordered = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        let unordered = ZyraSync(tableName: BenchmarkTask.schema.name, userId: "user-1", database: database)
+        ordered.columnOrder = ZyraColumnOrder(["title", "priority"])
+
+        // SQL text is shared per table, the order is not
+        XCTAssertTrue(ordered.writeStatements === unordered.writeStatements)
+        XCTAssertEqual(ordered.columnOrder.ordered(["priority", "title"]), ["title", "priority"])
+        XCTAssertEqual(unordered.columnOrder.ordered(["title", "priority"]), ["priority", "title"])
+
+        try await ZyraTestDatabase.close(database)
+    }
+}